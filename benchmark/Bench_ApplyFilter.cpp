@@ -1,5 +1,10 @@
+#include "dspbb/Filtering/Cic.hpp"
 #include "dspbb/Filtering/FIR.hpp"
+#include "dspbb/Filtering/Halfband.hpp"
 #include "dspbb/Filtering/IIR.hpp"
+#include "dspbb/Filtering/Multistage.hpp"
+#include "dspbb/Filtering/Resample.hpp"
+#include "dspbb/Math/OverlapAddBank.hpp"
 
 #include <array>
 #include <celero/Celero.h>
@@ -18,6 +23,8 @@ constexpr size_t signalSize = 262144;
 constexpr size_t maxFirOrder = 4096;
 constexpr size_t maxIirDirectOrder = 8;
 constexpr size_t maxIirCascadeOrder = 16;
+constexpr size_t streamBlockSize = 64; // Streaming benchmarks filter the signal in blocks of this size.
+constexpr size_t decimationRate = 8;
 
 constexpr size_t complexityLimit = signalSize * maxFirOrder;
 
@@ -67,6 +74,119 @@ public:
 };
 
 
+template <class T, size_t NumFilters>
+class FirBankFixture : public FirFilterFixture<T, 32, maxFirOrder, 16> {
+public:
+	void setUp(const ExperimentValue* experimentValue) override {
+		FirFilterFixture<T, 32, maxFirOrder, 16>::setUp(experimentValue);
+		outs = std::vector<Signal<T>>(NumFilters, this->out);
+		filters = std::vector<Signal<T>>(NumFilters, this->filter);
+		bank = OverlapAddBank<T>{ filters };
+	}
+
+	std::vector<Signal<T>> outs;
+	std::vector<Signal<T>> filters;
+	OverlapAddBank<T> bank;
+};
+
+
+template <class T>
+class LinearPhaseFixture : public FirFilterFixture<T> {
+public:
+	void setUp(const ExperimentValue* experimentValue) override {
+		FirFilterFixture<T>::setUp(experimentValue);
+		auto& taps = this->filter;
+		std::copy(taps.begin(), taps.begin() + taps.size() / 2, taps.rbegin());
+		linearPhase = LinearPhaseFilter<T>{ taps };
+	}
+
+	LinearPhaseFilter<T> linearPhase;
+};
+
+
+template <class T>
+class HalfbandFixture : public FirFilterFixture<T, 2> {
+public:
+	void setUp(const ExperimentValue* experimentValue) override {
+		FirFilterFixture<T, 2>::setUp(experimentValue);
+		DesignFilter(this->filter, Fir.Lowpass.Windowed.Cutoff(0.5f));
+		decimator = HalfbandDecimator<T>{ this->filter };
+	}
+
+	HalfbandDecimator<T> decimator;
+};
+
+
+class DecimationFixture : public celero::TestFixture {
+public:
+	std::vector<std::shared_ptr<ExperimentValue>> getExperimentValues() const override {
+		std::vector<std::shared_ptr<ExperimentValue>> experimentValues;
+		for (int64_t rate : { 8, 64, 512 }) {
+			experimentValues.emplace_back(std::make_shared<ExperimentValue>(rate, 4));
+		};
+		return experimentValues;
+	}
+
+	void setUp(const ExperimentValue* experimentValue) override {
+		rate = experimentValue->Value;
+		out = Signal<float>(signalSize / rate);
+		signal = Signal<int16_t>(signalSize);
+		signalFloat = Signal<float>(signalSize);
+		for (size_t i = 0; i < signalSize; ++i) {
+			signal[i] = int16_t(randomFloat(rne) * 32767.0f);
+			signalFloat[i] = float(signal[i]);
+		}
+		filter = DesignFilter<float, TIME_DOMAIN>(4 * rate + 1, Fir.Lowpass.Windowed.Cutoff(1.0f / float(rate)));
+		state = Signal<float>(filter.size() - 1, 0.0f);
+		cic = CicDecimator<float, int16_t>{ 4, 1, rate };
+	}
+
+	size_t rate = 1;
+	Signal<float> out;
+	Signal<int16_t> signal;
+	Signal<float> signalFloat;
+	Signal<float> filter;
+	Signal<float> state;
+	CicDecimator<float, int16_t> cic;
+};
+
+
+class MultistageFixture : public celero::TestFixture {
+public:
+	std::vector<std::shared_ptr<ExperimentValue>> getExperimentValues() const override {
+		std::vector<std::shared_ptr<ExperimentValue>> experimentValues;
+		for (int64_t rate : { 8, 64, 512 }) {
+			experimentValues.emplace_back(std::make_shared<ExperimentValue>(rate, 4));
+		};
+		return experimentValues;
+	}
+
+	void setUp(const ExperimentValue* experimentValue) override {
+		rate = experimentValue->Value;
+		out = Signal<float>(signalSize / rate);
+		signal = Signal<float>(signalSize);
+		for (auto& v : signal) {
+			v = randomFloat(rne);
+		}
+		// The single stage meets the same passband and attenuation with the final transition band at the high rate.
+		const float passband = 0.8f;
+		const float attenuation = 80.0f;
+		const size_t singleSize = impl::EstimateMultistageFilterSize((1.0 - passband) / double(rate), attenuation);
+		const auto window = windows::kaiser.alpha(impl::KaiserAlpha(attenuation));
+		filter = DesignFilter<float, TIME_DOMAIN>(singleSize, Fir.Lowpass.Windowed.Cutoff((1.0f + passband) / 2.0f / float(rate)).Window(window));
+		state = Signal<float>(filter.size() - 1, 0.0f);
+		decimator = MultistageDecimator<float>{ size_t(rate), passband, attenuation };
+	}
+
+	size_t rate = 1;
+	Signal<float> out;
+	Signal<float> signal;
+	Signal<float> filter;
+	Signal<float> state;
+	MultistageDecimator<float> decimator;
+};
+
+
 template <class T, int64_t MaxOrder>
 class DesignFilterFixture : public celero::TestFixture {
 public:
@@ -120,6 +240,7 @@ using ConvFixture = FirFilterFixture<float, 1, maxFirOrder, 16>;
 using OlaFixture = FirFilterFixture<float, 32, maxFirOrder, 16>;
 using TfFixture = DesignFilterFixture<float, maxIirDirectOrder>;
 using CascadeFixture = DesignFilterFixture<float, maxIirCascadeOrder>;
+using BankFixture = FirBankFixture<float, 32>;
 
 BASELINE_F(ApplyFilter, gain, BaselineFixture, 25, 1) {
 	Multiply(AsView(out).subsignal(0, signal.size()), signal, filter[0]);
@@ -131,11 +252,79 @@ BENCHMARK_F(ApplyFilter, fir_conv, FirFilterFixture<float>, 25, 1) {
 	celero::DoNotOptimizeAway(out[0]);
 }
 
+BENCHMARK_F(ApplyFilter, fir_conv_mt, FirFilterFixture<float>, 25, 1) {
+	Filter(out, signal, filter, CONV_FULL, FILTER_CONV, ParallelExecution{});
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_linear_phase, LinearPhaseFixture<float>, 25, 1) {
+	Filter(out, signal, linearPhase, CONV_FULL);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_stream_state, FirFilterFixture<float>, 25, 1) {
+	Signal<float> state(filter.size() - 1, 0.0f);
+	for (size_t first = 0; first < signal.size(); first += streamBlockSize) {
+		Filter(AsView(out).subsignal(first, streamBlockSize), AsConstView(signal).subsignal(first, streamBlockSize), filter, state, FILTER_CONV);
+	}
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_stream_object, FirFilterFixture<float>, 25, 1) {
+	FirFilter<float> fir{ filter };
+	for (size_t first = 0; first < signal.size(); first += streamBlockSize) {
+		fir.process(AsView(out).subsignal(first, streamBlockSize), AsConstView(signal).subsignal(first, streamBlockSize));
+	}
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_decimate_full_rate, FirFilterFixture<float>, 25, 1) {
+	Signal<float> state(filter.size() - 1, 0.0f);
+	const auto filtered = AsView(out).subsignal(0, signal.size());
+	Filter(filtered, signal, filter, state, FILTER_CONV);
+	Decimate(AsView(out).subsignal(0, signal.size() / decimationRate), filtered, decimationRate); // Reads ahead of writes.
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_decimate, FirFilterFixture<float>, 25, 1) {
+	Signal<float> state(filter.size() - 1, 0.0f);
+	FilterDecimate(AsView(out).subsignal(0, signal.size() / decimationRate), signal, filter, decimationRate, state);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_halfband_full_rate, HalfbandFixture<float>, 25, 1) {
+	Signal<float> state(filter.size() - 1, 0.0f);
+	const auto filtered = AsView(out).subsignal(0, signal.size());
+	Filter(filtered, signal, filter, state, FILTER_CONV);
+	Decimate(AsView(out).subsignal(0, signal.size() / 2), filtered, 2); // Reads ahead of writes.
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_halfband, HalfbandFixture<float>, 25, 1) {
+	decimator.process(AsView(out).subsignal(0, signal.size() / 2), signal);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
 BENCHMARK_F(ApplyFilter, fir_ola, OlaFixture, 25, 1) {
 	Filter(out, signal, filter, CONV_FULL, FILTER_OLA);
 	celero::DoNotOptimizeAway(out[0]);
 }
 
+BENCHMARK_F(ApplyFilter, fir_ola_mt, OlaFixture, 25, 1) {
+	Filter(out, signal, filter, CONV_FULL, FILTER_OLA, ParallelExecution{});
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_ols, OlaFixture, 25, 1) {
+	Filter(out, signal, filter, CONV_FULL, FILTER_OLS);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(ApplyFilter, fir_auto, FirFilterFixture<float>, 25, 1) {
+	Filter(out, signal, filter, CONV_FULL, FILTER_AUTO);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
 BENCHMARK_F(ApplyFilter, iir_df_i, TfFixture, 25, 1) {
 	const auto realization = TransferFunction{ filter };
 	DirectFormI<float> state{ realization.order() };
@@ -155,4 +344,41 @@ BENCHMARK_F(ApplyFilter, iir_cascade, CascadeFixture, 25, 1) {
 	CascadedForm<float> state{ realization.order() };
 	Filter(out, signal, realization, state);
 	celero::DoNotOptimizeAway(out[0]);
-}
\ No newline at end of file
+}
+
+BASELINE_F(FilterBank, separate_ola, BankFixture, 10, 1) {
+	for (size_t i = 0; i < filters.size(); ++i) {
+		Filter(outs[i], signal, filters[i], CONV_FULL, FILTER_OLA);
+	}
+	celero::DoNotOptimizeAway(outs[0][0]);
+}
+
+BENCHMARK_F(FilterBank, bank, BankFixture, 10, 1) {
+	bank.process(outs, signal, CONV_FULL);
+	celero::DoNotOptimizeAway(outs[0][0]);
+}
+
+BENCHMARK_F(FilterBank, bank_mt, BankFixture, 10, 1) {
+	bank.process(outs, signal, CONV_FULL, ParallelExecution{});
+	celero::DoNotOptimizeAway(outs[0][0]);
+}
+
+BASELINE_F(Decimation, fir_polyphase, DecimationFixture, 10, 1) {
+	FilterDecimate(out, signalFloat, filter, rate, state);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(Decimation, cic, DecimationFixture, 10, 1) {
+	cic.process(out, signal);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BASELINE_F(MultistageDecimation, single_stage, MultistageFixture, 10, 1) {
+	FilterDecimate(out, signal, filter, rate, state);
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(MultistageDecimation, multistage, MultistageFixture, 10, 1) {
+	decimator.process(out, signal);
+	celero::DoNotOptimizeAway(out[0]);
+}
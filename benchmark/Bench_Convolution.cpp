@@ -2,6 +2,7 @@
 #include <dspbb/Math/Convolution.hpp>
 
 #include <array>
+#include <cassert>
 #include <celero/Celero.h>
 #include <random>
 #include <vector>
@@ -34,6 +35,9 @@ static constexpr std::array filterSizes = {
 	512,
 	1024,
 	2048,
+	4096,
+	8192,
+	16384,
 };
 
 constexpr int complexityLimit = 128 * 1024 * 1024;
@@ -113,6 +117,27 @@ BENCHMARK_F(ConvolutionCache, reduce_fast, FixtureCache, 25, 500) {
 	celero::DoNotOptimizeAway(out.front());
 }
 
+BENCHMARK_F(ConvolutionCache, blocked_comp, FixtureCache, 25, 500) {
+	kernels::ConvolutionReduceBlocked(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, plus_compensated<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionCache, blocked_fast, FixtureCache, 25, 500) {
+	kernels::ConvolutionReduceBlocked(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, std::plus<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionCache, blocked_fast_8, FixtureCache, 25, 500) {
+	kernels::ConvolutionReduceBlocked<8>(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, std::plus<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionCache, tiled_comp, FixtureCache, 25, 500) {
+	const auto [outputTile, filterTile] = kernels::ConvolutionTileSizes<float, float>(GetCacheSizes());
+	kernels::ConvolutionReduceTiled(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, outputTile, filterTile, false, plus_compensated<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
 using FixtureLarge = ConvolutionFixture<float, signalSizes[1]>;
 
 BASELINE_F(ConvolutionLarge, naive, FixtureLarge, 25, 500) {
@@ -134,3 +159,82 @@ BENCHMARK_F(ConvolutionLarge, reduce_fast, FixtureLarge, 25, 500) {
 	kernels::ConvolutionReduceVec(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, std::plus<>{});
 	celero::DoNotOptimizeAway(out.front());
 }
+
+BENCHMARK_F(ConvolutionLarge, blocked_comp, FixtureLarge, 25, 500) {
+	kernels::ConvolutionReduceBlocked(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, plus_compensated<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionLarge, blocked_fast, FixtureLarge, 25, 500) {
+	kernels::ConvolutionReduceBlocked(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, std::plus<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionLarge, blocked_fast_8, FixtureLarge, 25, 500) {
+	kernels::ConvolutionReduceBlocked<8>(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, std::plus<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionLarge, tiled_comp, FixtureLarge, 25, 500) {
+	const auto [outputTile, filterTile] = kernels::ConvolutionTileSizes<float, float>(GetCacheSizes());
+	kernels::ConvolutionReduceTiled(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, outputTile, filterTile, false, plus_compensated<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+
+//------------------------------------------------------------------------------
+// Fixed-length kernels
+//------------------------------------------------------------------------------
+
+static constexpr std::array fixedFilterSizes = {
+	3,
+	7,
+	15,
+	31,
+};
+
+template <class T, size_t SignalSize>
+class FixedConvolutionFixture : public ConvolutionFixture<T, SignalSize> {
+public:
+	std::vector<std::shared_ptr<ExperimentValue>> getExperimentValues() const override {
+		std::vector<std::shared_ptr<ExperimentValue>> experimentValues;
+		for (auto& filterSize : fixedFilterSizes) {
+			const auto iterations = complexityLimit / (filterSize * SignalSize);
+			experimentValues.emplace_back(std::make_shared<ExperimentValue>(int64_t(filterSize), std::max(int64_t(1), int64_t(iterations))));
+		};
+		return experimentValues;
+	}
+};
+
+template <size_t N, class T>
+void ConvolutionFixed(const std::vector<T>& signal, const std::vector<T>& filter, std::vector<T>& out) {
+	kernels::ConvolutionFixed<N>(filter.begin(), signal.begin(), signal.end(), out.begin(), out.end(), 0);
+}
+
+template <class T>
+void ConvolutionFixed(const std::vector<T>& signal, const std::vector<T>& filter, std::vector<T>& out) {
+	switch (filter.size()) {
+		case 3: ConvolutionFixed<3>(signal, filter, out); break;
+		case 7: ConvolutionFixed<7>(signal, filter, out); break;
+		case 15: ConvolutionFixed<15>(signal, filter, out); break;
+		case 31: ConvolutionFixed<31>(signal, filter, out); break;
+		default: assert(false);
+	}
+}
+
+using FixtureFixed = FixedConvolutionFixture<float, signalSizes[1]>;
+
+BASELINE_F(ConvolutionFixedLength, slide, FixtureFixed, 25, 500) {
+	kernels::ConvolutionSlide(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0);
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionFixedLength, blocked_fast, FixtureFixed, 25, 500) {
+	kernels::ConvolutionReduceBlocked(signal.begin(), signal.end(), filter.begin(), filter.end(), out.begin(), out.end(), 0, false, std::plus<>{});
+	celero::DoNotOptimizeAway(out.front());
+}
+
+BENCHMARK_F(ConvolutionFixedLength, fixed, FixtureFixed, 25, 500) {
+	ConvolutionFixed(signal, filter, out);
+	celero::DoNotOptimizeAway(out.front());
+}
@@ -0,0 +1,98 @@
+#include <dspbb/Math/PartitionedConvolution.hpp>
+
+#include <array>
+#include <celero/Celero.h>
+#include <random>
+#include <vector>
+
+
+using namespace dspbb;
+
+
+//------------------------------------------------------------------------------
+// Input sizes for which to benchmark
+//------------------------------------------------------------------------------
+
+constexpr size_t blockSize = 64;
+
+static constexpr std::array filterSizes = {
+	4096,
+	16384,
+	65536,
+};
+
+
+//------------------------------------------------------------------------------
+// Fixtures to generate random input
+//------------------------------------------------------------------------------
+
+static std::minstd_rand rne;
+static std::uniform_real_distribution<float> randomFloat(-1, 1);
+
+// Each sample processes a single block. The convolver is positioned so that this is the block
+// on which the blocks of all segments complete at the same time, which is the worst case.
+template <class Convolver, bool BackgroundThread = false>
+class WorstBlockFixture : public celero::TestFixture {
+public:
+	std::vector<std::shared_ptr<ExperimentValue>> getExperimentValues() const override {
+		std::vector<std::shared_ptr<ExperimentValue>> experimentValues;
+		for (auto& filterSize : filterSizes) {
+			experimentValues.emplace_back(std::make_shared<ExperimentValue>(int64_t(filterSize), int64_t(1)));
+		};
+		return experimentValues;
+	}
+
+	void setUp(const ExperimentValue* experimentValue) override {
+		const size_t filterSize = experimentValue->Value;
+		Signal<float> filter(filterSize);
+		for (auto& v : filter) {
+			v = randomFloat(rne);
+		}
+		block = Signal<float>(blockSize);
+		for (auto& v : block) {
+			v = randomFloat(rne);
+		}
+		out = Signal<float>(blockSize);
+
+		size_t period = blockSize;
+		if constexpr (std::is_same_v<Convolver, NonUniformConvolver<float>>) {
+			convolver = Convolver{ filter, blockSize, 0, BackgroundThread };
+			const auto segmentBlockSizes = convolver.segmentBlockSizes();
+			period = segmentBlockSizes.empty() ? blockSize : segmentBlockSizes.back();
+		}
+		else {
+			convolver = Convolver{ filter, blockSize };
+		}
+		for (size_t time = 0; time + blockSize < period; time += blockSize) {
+			convolver.process(AsView(out), AsConstView(block));
+		}
+	}
+
+	Convolver convolver;
+	Signal<float> block;
+	Signal<float> out;
+};
+
+
+//------------------------------------------------------------------------------
+// Benchmarks
+//------------------------------------------------------------------------------
+
+using UniformFixture = WorstBlockFixture<PartitionedConvolver<float>>;
+using NonUniformFixture = WorstBlockFixture<NonUniformConvolver<float>>;
+using NonUniformBackgroundFixture = WorstBlockFixture<NonUniformConvolver<float>, true>;
+
+BASELINE_F(PartitionedConvolutionWorstBlock, uniform, UniformFixture, 30, 1) {
+	convolver.process(AsView(out), AsConstView(block));
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(PartitionedConvolutionWorstBlock, non_uniform, NonUniformFixture, 30, 1) {
+	convolver.process(AsView(out), AsConstView(block));
+	celero::DoNotOptimizeAway(out[0]);
+}
+
+BENCHMARK_F(PartitionedConvolutionWorstBlock, non_uniform_background, NonUniformBackgroundFixture, 30, 1) {
+	convolver.process(AsView(out), AsConstView(block));
+	celero::DoNotOptimizeAway(out[0]);
+}
@@ -0,0 +1,98 @@
+#include <dspbb/Filtering/Windowing.hpp>
+#include <dspbb/Math/STFT.hpp>
+
+#include <array>
+#include <celero/Celero.h>
+#include <random>
+#include <vector>
+
+
+using namespace dspbb;
+
+
+//------------------------------------------------------------------------------
+// Input sizes for which to benchmark
+//------------------------------------------------------------------------------
+
+constexpr size_t signalSize = 262144;
+constexpr size_t blockSize = 512;
+constexpr size_t overlap = 4;
+
+static constexpr std::array frameSizes = {
+	256,
+	512,
+	1024,
+	2048,
+};
+
+
+//------------------------------------------------------------------------------
+// Fixtures to generate random input
+//------------------------------------------------------------------------------
+
+static std::minstd_rand rne;
+static std::uniform_real_distribution<float> randomFloat(-1, 1);
+
+template <class T>
+class StftFixture : public celero::TestFixture {
+public:
+	std::vector<std::shared_ptr<ExperimentValue>> getExperimentValues() const override {
+		std::vector<std::shared_ptr<ExperimentValue>> experimentValues;
+		for (auto& frameSize : frameSizes) {
+			experimentValues.emplace_back(std::make_shared<ExperimentValue>(int64_t(frameSize), int64_t(8)));
+		};
+		return experimentValues;
+	}
+
+	void setUp(const ExperimentValue* experimentValue) override {
+		const size_t frameSize = experimentValue->Value;
+		const size_t hopSize = frameSize / overlap;
+
+		Signal<T> window(frameSize);
+		HammingWindow(window);
+		stft = Stft<T>{ AsConstView(window), hopSize };
+		istft = Istft<T>{ AsConstView(window), hopSize };
+
+		signal = Signal<T>(signalSize);
+		for (auto& v : signal) {
+			v = static_cast<T>(randomFloat(rne));
+		}
+		out = Signal<T>(signalSize, T(0));
+		spectrogram = Spectrum<std::complex<T>>((blockSize / hopSize + 1) * stft.binCount());
+	}
+
+	void Analyze() {
+		for (size_t first = 0; first + blockSize <= signal.size(); first += blockSize) {
+			stft.feed(AsView(spectrogram), AsConstView(signal).subsignal(first, blockSize));
+		}
+	}
+
+	void RoundTrip() {
+		size_t numSamples = 0;
+		for (size_t first = 0; first + blockSize <= signal.size(); first += blockSize) {
+			const size_t numFrames = stft.feed(AsView(spectrogram), AsConstView(signal).subsignal(first, blockSize));
+			numSamples += istft.feed(AsView(out).subsignal(numSamples), AsConstView(spectrogram).subsignal(0, numFrames * stft.binCount()));
+		}
+	}
+
+	Stft<T> stft;
+	Istft<T> istft;
+	Signal<T> signal;
+	Signal<T> out;
+	Spectrum<std::complex<T>> spectrogram;
+};
+
+
+//------------------------------------------------------------------------------
+// Benchmarks
+//------------------------------------------------------------------------------
+
+BASELINE_F(Stft, analysis, StftFixture<float>, 25, 1) {
+	Analyze();
+	celero::DoNotOptimizeAway(spectrogram[0]);
+}
+
+BENCHMARK_F(Stft, round_trip, StftFixture<float>, 25, 1) {
+	RoundTrip();
+	celero::DoNotOptimizeAway(out[0]);
+}
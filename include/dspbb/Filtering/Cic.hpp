@@ -0,0 +1,346 @@
+#pragma once
+
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalView.hpp"
+#include "../Utility/Numbers.hpp"
+#include "FIR.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+namespace dspbb {
+
+namespace impl {
+	// The registers of CIC filters wrap around modulo 2^64. The integrators overflow all the time, but as long as the
+	// true output fits in the registers, the wrapped differences taken by the combs still give the exact result.
+	using CicRegister = uint64_t;
+
+	template <class I>
+	void ThrowIfCicOverflows(size_t order, size_t delay, size_t rate) {
+		if (order == 0 || delay == 0 || rate == 0) {
+			throw std::invalid_argument("CIC order, differential delay and rate must be positive.");
+		}
+		// The output is decoded as a signed 64 bit integer, so unsigned inputs need a sign bit as well.
+		const size_t inputBits = size_t(std::numeric_limits<I>::digits) + 1;
+		const size_t growthBits = order * size_t(std::ceil(std::log2(double(rate) * double(delay))));
+		if (inputBits + growthBits > size_t(std::numeric_limits<CicRegister>::digits)) {
+			throw std::invalid_argument("CIC output does not fit in 64 bit registers, reduce the order, delay or rate.");
+		}
+	}
+
+	inline CicRegister ToCicRegister(int64_t value) {
+		return CicRegister(value);
+	}
+
+	inline int64_t FromCicRegister(CicRegister value) {
+		return value <= CicRegister(std::numeric_limits<int64_t>::max()) ? int64_t(value) : -int64_t(~value) - 1;
+	}
+
+	// The integrators and combs work on chunks of this many high-rate samples, so that each integrator
+	// runs over a whole chunk with its sum held in a register.
+	constexpr size_t cicChunkSize = 256;
+
+	// Runs a fixed number of integrators over the chunk in place. All sums stay in registers and the stages
+	// of one sample only depend on each other through a single add, so they overlap from sample to sample.
+	template <size_t Order>
+	void CicIntegrateFixed(CicRegister* first, CicRegister* last, std::vector<CicRegister>& integrators) {
+		std::array<CicRegister, Order> sums;
+		std::copy(integrators.begin(), integrators.end(), sums.begin());
+		for (auto it = first; it != last; ++it) {
+			CicRegister value = *it;
+			for (size_t stage = 0; stage < Order; ++stage) {
+				sums[stage] += value;
+				value = sums[stage];
+			}
+			*it = value;
+		}
+		std::copy(sums.begin(), sums.end(), integrators.begin());
+	}
+
+	// Runs the integrators over the chunk in place.
+	inline void CicIntegrate(CicRegister* first, CicRegister* last, std::vector<CicRegister>& integrators) {
+		switch (integrators.size()) {
+			case 1: return CicIntegrateFixed<1>(first, last, integrators);
+			case 2: return CicIntegrateFixed<2>(first, last, integrators);
+			case 3: return CicIntegrateFixed<3>(first, last, integrators);
+			case 4: return CicIntegrateFixed<4>(first, last, integrators);
+			case 5: return CicIntegrateFixed<5>(first, last, integrators);
+			case 6: return CicIntegrateFixed<6>(first, last, integrators);
+			default:
+				for (auto& integrator : integrators) {
+					CicRegister sum = integrator;
+					for (auto it = first; it != last; ++it) {
+						sum += *it;
+						*it = sum;
+					}
+					integrator = sum;
+				}
+		}
+	}
+
+	// Runs a single sample through the combs. Each stage keeps its last delay inputs in a ring,
+	// all rings share the same position.
+	inline CicRegister CicComb(CicRegister value, std::vector<CicRegister>& combs, size_t delay, size_t& position) {
+		for (size_t stageOffset = 0; stageOffset < combs.size(); stageOffset += delay) {
+			CicRegister& delayed = combs[stageOffset + position];
+			const CicRegister input = value;
+			value -= delayed;
+			delayed = input;
+		}
+		position = position + 1 == delay ? 0 : position + 1;
+		return value;
+	}
+
+	// The DC gain of the integrators and combs, (rate * delay)^order.
+	inline double CicGain(size_t order, size_t delay, size_t rate) {
+		return std::pow(double(rate) * double(delay), double(order));
+	}
+} // namespace impl
+
+
+/// <summary> Returns the magnitude response of a CIC filter normalized to unity DC gain. </summary>
+/// <param name="frequency"> Normalized to the low sample rate, 1 is its Nyquist frequency. </param>
+template <class T>
+T CicResponse(T frequency, size_t order, size_t delay, size_t rate) {
+	const double x = pi_v<double> * double(frequency) / 2.0;
+	if (x == 0.0) {
+		return T(1);
+	}
+	const double ratio = std::sin(double(delay) * x) / (double(rate) * double(delay) * std::sin(x / double(rate)));
+	return T(std::pow(std::abs(ratio), double(order)));
+}
+
+
+/// <summary> Designs a FIR filter that flattens the passband droop of a CIC filter. </summary>
+/// <remarks> The filter runs at the low sample rate, after a CIC decimator or before a CIC interpolator.
+///		It is designed by least squares to the inverse of the CIC response in the passband and to zero in the
+///		stopband, with the band between them left free. The DC gain is normalized to one. </remarks>
+/// <param name="cutoff"> The end of the passband, normalized to the low sample rate. </param>
+/// <param name="stopband"> The start of the stopband, 0 puts it halfway between the cutoff and Nyquist. </param>
+template <class SignalR, std::enable_if_t<is_mutable_signal_v<SignalR>, int> = 0>
+void DesignCicCompensator(SignalR&& out, size_t order, size_t delay, size_t rate, float cutoff, float stopband = 0.0f) {
+	impl::ThrowIfNotNormalized(cutoff);
+	impl::ThrowIfNotNormalized(stopband);
+	stopband = stopband == 0.0f ? (1.0f + cutoff) / 2.0f : stopband;
+	assert(cutoff < stopband);
+
+	const auto response = [=](auto f) {
+		using F = std::decay_t<decltype(f)>;
+		return f <= F(cutoff) ? F(1) / CicResponse(f, order, delay, rate) : F(0);
+	};
+	const auto weight = [=](auto f) {
+		using F = std::decay_t<decltype(f)>;
+		return f <= F(cutoff) || F(stopband) <= f ? F(1) : F(0);
+	};
+	DesignFilter(out, Fir.Arbitrary.LeastSquares.Response(response).Weight(weight));
+	out *= remove_complex_t<typename signal_traits<std::decay_t<SignalR>>::type>(1) / Sum(out);
+}
+
+template <class T, eSignalDomain Domain>
+auto DesignCicCompensator(size_t taps, size_t order, size_t delay, size_t rate, float cutoff, float stopband = 0.0f) {
+	BasicSignal<T, Domain> out(taps);
+	DesignCicCompensator(out, order, delay, rate, cutoff, stopband);
+	return out;
+}
+
+
+/// <summary> Streaming cascaded integrator-comb decimator. </summary>
+/// <remarks> The filter takes no multiplies: the input goes through order integrators at the high rate, every rate-th
+///		sample is kept, and the result goes through order combs with the given differential delay at the low rate.
+///		The output is that of filtering with order boxcars of rate * delay taps and keeping every rate-th sample,
+///		starting with the first, scaled to unity DC gain. The integer registers wrap around safely.
+///		Blocks can be of any size, the decimation phase carries over. </remarks>
+/// <typeparam name="T"> The output samples. </typeparam>
+/// <typeparam name="I"> The integer input samples. </typeparam>
+template <class T, class I = int32_t>
+class CicDecimator {
+	static_assert(std::is_integral_v<I>, "CIC filters work on integer samples.");
+
+public:
+	CicDecimator() = default;
+	/// <exception cref="std::invalid_argument"> A parameter is zero or the output does not fit into the registers. </exception>
+	CicDecimator(size_t order, size_t delay, size_t rate);
+
+	size_t order() const;
+	size_t delay() const;
+	size_t rate() const;
+	/// <summary> The number of output samples the next block of inputSize samples produces. </summary>
+	size_t outputSize(size_t inputSize) const;
+
+	/// <param name="out"> Must have outputSize(in.size()) samples. </param>
+	void process(SignalView<T> out, SignalView<const I> in);
+	void reset();
+
+private:
+	std::vector<impl::CicRegister> m_integrators;
+	std::vector<impl::CicRegister> m_combs;
+	std::vector<impl::CicRegister> m_chunk;
+	size_t m_delay = 1;
+	size_t m_rate = 1;
+	size_t m_combPosition = 0;
+	size_t m_phase = 0;
+	T m_scale = T(1);
+};
+
+
+/// <summary> Streaming cascaded integrator-comb interpolator. </summary>
+/// <remarks> The filter takes no multiplies: the input goes through order combs with the given differential delay at
+///		the low rate, rate - 1 zeros are inserted after each sample, and the result goes through order integrators
+///		at the high rate. The output is scaled so that a constant input gives the same constant output. </remarks>
+/// <typeparam name="T"> The output samples. </typeparam>
+/// <typeparam name="I"> The integer input samples. </typeparam>
+template <class T, class I = int32_t>
+class CicInterpolator {
+	static_assert(std::is_integral_v<I>, "CIC filters work on integer samples.");
+
+public:
+	CicInterpolator() = default;
+	/// <exception cref="std::invalid_argument"> A parameter is zero or the output does not fit into the registers. </exception>
+	CicInterpolator(size_t order, size_t delay, size_t rate);
+
+	size_t order() const;
+	size_t delay() const;
+	size_t rate() const;
+
+	/// <param name="out"> Must have rate() times as many samples as the input. </param>
+	void process(SignalView<T> out, SignalView<const I> in);
+	void reset();
+
+private:
+	std::vector<impl::CicRegister> m_integrators;
+	std::vector<impl::CicRegister> m_combs;
+	std::vector<impl::CicRegister> m_chunk;
+	size_t m_delay = 1;
+	size_t m_rate = 1;
+	size_t m_combPosition = 0;
+	T m_scale = T(1);
+};
+
+
+//------------------------------------------------------------------------------
+// Decimator
+//------------------------------------------------------------------------------
+
+template <class T, class I>
+CicDecimator<T, I>::CicDecimator(size_t order, size_t delay, size_t rate) : m_delay(delay), m_rate(rate) {
+	impl::ThrowIfCicOverflows<I>(order, delay, rate);
+	m_integrators.resize(order, 0);
+	m_combs.resize(order * delay, 0);
+	m_chunk.resize(impl::cicChunkSize);
+	m_scale = T(1.0 / impl::CicGain(order, delay, rate));
+}
+
+template <class T, class I>
+size_t CicDecimator<T, I>::order() const {
+	return m_integrators.size();
+}
+
+template <class T, class I>
+size_t CicDecimator<T, I>::delay() const {
+	return m_delay;
+}
+
+template <class T, class I>
+size_t CicDecimator<T, I>::rate() const {
+	return m_rate;
+}
+
+template <class T, class I>
+size_t CicDecimator<T, I>::outputSize(size_t inputSize) const {
+	const size_t firstKept = (m_rate - m_phase) % m_rate;
+	return inputSize > firstKept ? (inputSize - firstKept - 1) / m_rate + 1 : 0;
+}
+
+template <class T, class I>
+void CicDecimator<T, I>::process(SignalView<T> out, SignalView<const I> in) {
+	assert(out.size() == outputSize(in.size()));
+
+	auto outIt = out.begin();
+	for (size_t first = 0; first < in.size(); first += impl::cicChunkSize) {
+		const size_t count = std::min(impl::cicChunkSize, in.size() - first);
+		std::transform(in.begin() + first, in.begin() + first + count, m_chunk.begin(), [](const I& sample) {
+			return impl::ToCicRegister(int64_t(sample));
+		});
+		impl::CicIntegrate(m_chunk.data(), m_chunk.data() + count, m_integrators);
+
+		for (size_t i = (m_rate - m_phase) % m_rate; i < count; i += m_rate) {
+			const impl::CicRegister value = impl::CicComb(m_chunk[i], m_combs, m_delay, m_combPosition);
+			*outIt++ = T(impl::FromCicRegister(value)) * m_scale;
+		}
+		m_phase = (m_phase + count) % m_rate;
+	}
+}
+
+template <class T, class I>
+void CicDecimator<T, I>::reset() {
+	std::fill(m_integrators.begin(), m_integrators.end(), impl::CicRegister(0));
+	std::fill(m_combs.begin(), m_combs.end(), impl::CicRegister(0));
+	m_combPosition = 0;
+	m_phase = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// Interpolator
+//------------------------------------------------------------------------------
+
+template <class T, class I>
+CicInterpolator<T, I>::CicInterpolator(size_t order, size_t delay, size_t rate) : m_delay(delay), m_rate(rate) {
+	impl::ThrowIfCicOverflows<I>(order, delay, rate);
+	m_integrators.resize(order, 0);
+	m_combs.resize(order * delay, 0);
+	m_chunk.resize(std::max(size_t(1), impl::cicChunkSize / rate) * rate);
+	m_scale = T(double(rate) / impl::CicGain(order, delay, rate));
+}
+
+template <class T, class I>
+size_t CicInterpolator<T, I>::order() const {
+	return m_integrators.size();
+}
+
+template <class T, class I>
+size_t CicInterpolator<T, I>::delay() const {
+	return m_delay;
+}
+
+template <class T, class I>
+size_t CicInterpolator<T, I>::rate() const {
+	return m_rate;
+}
+
+template <class T, class I>
+void CicInterpolator<T, I>::process(SignalView<T> out, SignalView<const I> in) {
+	assert(out.size() == in.size() * m_rate);
+
+	// Each comb output is followed by rate - 1 zeros, then the chunk is integrated at the high rate.
+	const size_t inputsPerChunk = m_chunk.size() / m_rate;
+	for (size_t first = 0; first < in.size(); first += inputsPerChunk) {
+		const size_t count = std::min(inputsPerChunk, in.size() - first);
+		const size_t chunkSize = count * m_rate;
+		std::fill(m_chunk.begin(), m_chunk.begin() + chunkSize, impl::CicRegister(0));
+		for (size_t i = 0; i < count; ++i) {
+			m_chunk[i * m_rate] = impl::CicComb(impl::ToCicRegister(int64_t(in[first + i])), m_combs, m_delay, m_combPosition);
+		}
+		impl::CicIntegrate(m_chunk.data(), m_chunk.data() + chunkSize, m_integrators);
+		std::transform(m_chunk.begin(), m_chunk.begin() + chunkSize, out.begin() + first * m_rate, [this](impl::CicRegister value) {
+			return T(impl::FromCicRegister(value)) * m_scale;
+		});
+	}
+}
+
+template <class T, class I>
+void CicInterpolator<T, I>::reset() {
+	std::fill(m_integrators.begin(), m_integrators.end(), impl::CicRegister(0));
+	std::fill(m_combs.begin(), m_combs.end(), impl::CicRegister(0));
+	m_combPosition = 0;
+}
+
+} // namespace dspbb
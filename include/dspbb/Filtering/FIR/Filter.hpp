@@ -1,9 +1,15 @@
 #pragma once
 
 #include "../../Math/Convolution.hpp"
+#include "../../Math/FftConvolver.hpp"
 #include "../../Math/OverlapAdd.hpp"
+#include "../../Math/OverlapSave.hpp"
+#include "../../Math/PartitionedConvolution.hpp"
 #include "../../Primitives/SignalTraits.hpp"
 #include "../../Utility/TypeTraits.hpp"
+#include "FirFilter.hpp"
+#include "FixedFir.hpp"
+#include "LinearPhase.hpp"
 
 #include <cassert>
 
@@ -12,8 +18,12 @@ namespace dspbb {
 namespace impl {
 	struct FilterConv {};
 	struct FilterOla {};
+	struct FilterOls {};
+	struct FilterAuto {};
 	constexpr FilterConv FILTER_CONV;
 	constexpr FilterOla FILTER_OLA;
+	constexpr FilterOls FILTER_OLS;
+	constexpr FilterAuto FILTER_AUTO;
 
 
 	template <class SignalS, class SignalU>
@@ -24,6 +34,22 @@ namespace impl {
 		std::copy(signal.rbegin(), signal.rbegin() + std::min(signal.size(), state.size()), state.rbegin());
 	}
 
+	// Cost of overlap-add with the chunk size OverlapAdd would pick, in the units of the tuning profile.
+	inline double OverlapAddCost(size_t signalSize, size_t filterSize, const TuningProfile& profile) {
+		if (signalSize == 0 || filterSize == 0) {
+			return 0.0;
+		}
+		const auto [shorterSize, longerSize] = std::minmax(signalSize, filterSize);
+		const size_t chunkSize = ola::OptimalPracticalSize(longerSize, shorterSize, profile);
+		return ola::Cost(longerSize, shorterSize, chunkSize, profile);
+	}
+
+	// Direct convolution costs one multiply-accumulate per macCount.
+	inline bool PreferOverlapAdd(size_t signalSize, size_t filterSize, size_t macCount) {
+		const auto profile = GetTuningProfile();
+		return OverlapAddCost(signalSize, filterSize, profile) < profile.mac * double(macCount);
+	}
+
 	template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
 	using ProductSignalT = BasicSignal<multiplies_result_t<typename std::decay_t<SignalT>::value_type, typename std::decay_t<SignalU>::value_type>, signal_traits<std::decay_t<SignalT>>::domain>;
 } // namespace impl
@@ -31,6 +57,8 @@ namespace impl {
 
 using impl::FILTER_CONV;
 using impl::FILTER_OLA;
+using impl::FILTER_OLS;
+using impl::FILTER_AUTO;
 
 
 template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
@@ -38,21 +66,75 @@ auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::C
 	OverlapAdd(out, signal, filter, CONV_CENTRAL, chunkSize);
 }
 
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterOla, ParallelExecution execution, size_t chunkSize = 0) {
+	OverlapAdd(out, signal, filter, CONV_CENTRAL, execution, chunkSize);
+}
+
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterOls, size_t chunkSize = 0) {
+	OverlapSave(out, signal, filter, CONV_CENTRAL, chunkSize);
+}
+
 template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
 auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterConv) {
 	Convolution(out, signal, filter, CONV_CENTRAL);
 }
 
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterConv, ParallelExecution execution) {
+	Convolution(out, signal, filter, CONV_CENTRAL, execution);
+}
+
+/// <summary> Filters with direct convolution or overlap-add, whichever the tuning profile predicts to be faster. </summary>
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterAuto) {
+	const size_t macCount = ConvolutionLength(signal.size(), filter.size(), CONV_CENTRAL) * std::min(signal.size(), filter.size());
+	if (impl::PreferOverlapAdd(signal.size(), filter.size(), macCount)) {
+		Filter(out, signal, filter, CONV_CENTRAL, FILTER_OLA);
+	}
+	else {
+		Filter(out, signal, filter, CONV_CENTRAL, FILTER_CONV);
+	}
+}
+
 template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
 auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterOla, size_t chunkSize = 0) {
 	OverlapAdd(out, signal, filter, CONV_FULL, chunkSize);
 }
 
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterOla, ParallelExecution execution, size_t chunkSize = 0) {
+	OverlapAdd(out, signal, filter, CONV_FULL, execution, chunkSize);
+}
+
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterOls, size_t chunkSize = 0) {
+	OverlapSave(out, signal, filter, CONV_FULL, chunkSize);
+}
+
 template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
 auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterConv) {
 	Convolution(out, signal, filter, CONV_FULL);
 }
 
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterConv, ParallelExecution execution) {
+	Convolution(out, signal, filter, CONV_FULL, execution);
+}
+
+/// <summary> Filters with direct convolution or overlap-add, whichever the tuning profile predicts to be faster. </summary>
+template <class SignalR, class SignalU, class SignalV, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU, SignalV>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterAuto) {
+	const size_t macCount = signal.size() * filter.size();
+	if (impl::PreferOverlapAdd(signal.size(), filter.size(), macCount)) {
+		Filter(out, signal, filter, CONV_FULL, FILTER_OLA);
+	}
+	else {
+		Filter(out, signal, filter, CONV_FULL, FILTER_CONV);
+	}
+}
+
 template <class SignalR,
 		  class SignalU,
 		  class SignalV,
@@ -73,16 +155,49 @@ template <class SignalR,
 		  class SignalV,
 		  class SignalS,
 		  std::enable_if_t<is_mutable_signal_v<SignalR> && is_mutable_signal_v<SignalS> && is_same_domain_v<SignalR, SignalU, SignalV, SignalS>, int> = 0>
-auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, SignalS& state, impl::FilterConv) {
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, SignalS& state, impl::FilterOls, size_t chunkSize = 0) {
 	assert(state.size() == filter.size() - 1);
 	assert(out.size() == signal.size());
 
 	std::fill(out.begin(), out.end(), remove_complex_t<typename std::decay_t<SignalR>::value_type>(0));
+	OverlapSave(AsView(out).subsignal(0, std::min(out.size(), state.size())), state, filter, filter.size() - 1, chunkSize, false);
+	OverlapSave(out, signal, filter, 0, chunkSize, false);
+	impl::ShiftFilterState(state, signal);
+}
+
+template <class SignalR,
+		  class SignalU,
+		  class SignalV,
+		  class SignalS,
+		  std::enable_if_t<is_mutable_signal_v<SignalR> && is_mutable_signal_v<SignalS> && is_same_domain_v<SignalR, SignalU, SignalV, SignalS>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, SignalS& state, impl::FilterConv) {
+	assert(state.size() == filter.size() - 1);
+	assert(out.size() == signal.size());
+
+	// The signal overwrites the whole output, then the tail of the state is added to the front.
+	Convolution(out, signal, filter, 0);
 	Convolution(AsView(out).subsignal(0, std::min(out.size(), state.size())), state, filter, filter.size() - 1, false);
-	Convolution(out, signal, filter, 0, false);
 	impl::ShiftFilterState(state, signal);
 }
 
+template <class SignalR,
+		  class SignalU,
+		  class SignalV,
+		  class SignalS,
+		  std::enable_if_t<is_mutable_signal_v<SignalR> && is_mutable_signal_v<SignalS> && is_same_domain_v<SignalR, SignalU, SignalV, SignalS>, int> = 0>
+auto Filter(SignalR&& out, const SignalU& signal, const SignalV& filter, SignalS& state, impl::FilterAuto) {
+	// Overlap-add runs once over the state and once over the signal, so a short block pays for two chunk loops.
+	const size_t macCount = signal.size() * filter.size();
+	const auto profile = GetTuningProfile();
+	const double olaCost = impl::OverlapAddCost(signal.size(), filter.size(), profile) + impl::OverlapAddCost(state.size(), filter.size(), profile);
+	if (olaCost < profile.mac * double(macCount)) {
+		Filter(out, signal, filter, state, FILTER_OLA);
+	}
+	else {
+		Filter(out, signal, filter, state, FILTER_CONV);
+	}
+}
+
 template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
 auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterOla, size_t chunkSize = 0) {
 	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_CENTRAL));
@@ -90,6 +205,13 @@ auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvCentral, imp
 	return out;
 }
 
+template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
+auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterOls, size_t chunkSize = 0) {
+	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_CENTRAL));
+	Filter(out, signal, filter, CONV_CENTRAL, FILTER_OLS, chunkSize);
+	return out;
+}
+
 template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
 auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterConv) {
 	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_CENTRAL));
@@ -97,6 +219,13 @@ auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvCentral, imp
 	return out;
 }
 
+template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
+auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvCentral, impl::FilterAuto) {
+	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_CENTRAL));
+	Filter(out, signal, filter, CONV_CENTRAL, FILTER_AUTO);
+	return out;
+}
+
 template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
 auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterOla, size_t chunkSize = 0) {
 	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
@@ -104,6 +233,13 @@ auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::
 	return out;
 }
 
+template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
+auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterOls, size_t chunkSize = 0) {
+	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
+	Filter(out, signal, filter, CONV_FULL, FILTER_OLS, chunkSize);
+	return out;
+}
+
 template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
 auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterConv) {
 	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
@@ -111,6 +247,13 @@ auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::
 	return out;
 }
 
+template <class SignalU, class SignalV, std::enable_if_t<is_same_domain_v<SignalU, SignalV>, int> = 0>
+auto Filter(const SignalU& signal, const SignalV& filter, impl::ConvFull, impl::FilterAuto) {
+	impl::ProductSignalT<SignalU, SignalV> out(ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
+	Filter(out, signal, filter, CONV_FULL, FILTER_AUTO);
+	return out;
+}
+
 template <class SignalU,
 		  class SignalV,
 		  class SignalS,
@@ -121,6 +264,16 @@ auto Filter(const SignalU& signal, const SignalV& filter, SignalS&& state, impl:
 	return out;
 }
 
+template <class SignalU,
+		  class SignalV,
+		  class SignalS,
+		  std::enable_if_t<is_mutable_signal_v<SignalS> && is_same_domain_v<SignalU, SignalV, SignalS>, int> = 0>
+auto Filter(const SignalU& signal, const SignalV& filter, SignalS&& state, impl::FilterOls, size_t chunkSize = 0) {
+	impl::ProductSignalT<SignalU, SignalV> out(signal.size());
+	Filter(out, signal, filter, state, FILTER_OLS, chunkSize);
+	return out;
+}
+
 template <class SignalU,
 		  class SignalV,
 		  class SignalS,
@@ -131,4 +284,148 @@ auto Filter(const SignalU& signal, const SignalV& filter, SignalS&& state, impl:
 	return out;
 }
 
+template <class SignalU,
+		  class SignalV,
+		  class SignalS,
+		  std::enable_if_t<is_mutable_signal_v<SignalS> && is_same_domain_v<SignalU, SignalV, SignalS>, int> = 0>
+auto Filter(const SignalU& signal, const SignalV& filter, SignalS&& state, impl::FilterAuto) {
+	impl::ProductSignalT<SignalU, SignalV> out(signal.size());
+	Filter(out, signal, filter, state, FILTER_AUTO);
+	return out;
+}
+
+//------------------------------------------------------------------------------
+// Linear-phase filters stored as half of their taps
+//------------------------------------------------------------------------------
+
+template <class SignalR, class SignalU, class T, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, const LinearPhaseFilter<T>& filter, impl::ConvCentral) {
+	assert(out.size() == ConvolutionLength(signal.size(), filter.size(), CONV_CENTRAL) && "Use ConvolutionLength to calculate output size properly.");
+	Convolution(out, signal, filter, std::min(signal.size() - 1, filter.size() - 1));
+}
+
+template <class SignalR, class SignalU, class T, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, const LinearPhaseFilter<T>& filter, impl::ConvFull) {
+	assert(out.size() == ConvolutionLength(signal.size(), filter.size(), CONV_FULL) && "Use ConvolutionLength to calculate output size properly.");
+	Convolution(out, signal, filter, 0);
+}
+
+template <class SignalR, class SignalU, class T, class SignalS, std::enable_if_t<is_mutable_signal_v<SignalR> && is_mutable_signal_v<SignalS> && is_same_domain_v<SignalR, SignalU, SignalS>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, const LinearPhaseFilter<T>& filter, SignalS& state) {
+	assert(state.size() == filter.size() - 1);
+	assert(out.size() == signal.size());
+
+	Convolution(out, signal, filter, 0);
+	Convolution(AsView(out).subsignal(0, std::min(out.size(), state.size())), state, filter, filter.size() - 1, false);
+	impl::ShiftFilterState(state, signal);
+}
+
+template <class SignalU, class T>
+auto Filter(const SignalU& signal, const LinearPhaseFilter<T>& filter, impl::ConvCentral) {
+	BasicSignal<multiplies_result_t<typename std::decay_t<SignalU>::value_type, T>, signal_traits<std::decay_t<SignalU>>::domain> out(ConvolutionLength(signal.size(), filter.size(), CONV_CENTRAL));
+	Filter(out, signal, filter, CONV_CENTRAL);
+	return out;
+}
+
+template <class SignalU, class T>
+auto Filter(const SignalU& signal, const LinearPhaseFilter<T>& filter, impl::ConvFull) {
+	BasicSignal<multiplies_result_t<typename std::decay_t<SignalU>::value_type, T>, signal_traits<std::decay_t<SignalU>>::domain> out(ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
+	Filter(out, signal, filter, CONV_FULL);
+	return out;
+}
+
+template <class SignalU, class T, class SignalS, std::enable_if_t<is_mutable_signal_v<SignalS> && is_same_domain_v<SignalU, SignalS>, int> = 0>
+auto Filter(const SignalU& signal, const LinearPhaseFilter<T>& filter, SignalS&& state) {
+	BasicSignal<multiplies_result_t<typename std::decay_t<SignalU>::value_type, T>, signal_traits<std::decay_t<SignalU>>::domain> out(signal.size());
+	Filter(out, signal, filter, state);
+	return out;
+}
+
+//------------------------------------------------------------------------------
+// Filters with a tap count known at compile time
+//------------------------------------------------------------------------------
+
+template <class SignalR, class SignalU, class T, size_t N, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, const FixedFir<T, N>& filter, impl::ConvCentral) {
+	assert(out.size() == ConvolutionLength(signal.size(), N, CONV_CENTRAL) && "Use ConvolutionLength to calculate output size properly.");
+	Convolution(out, signal, filter, std::min(signal.size() - 1, N - 1));
+}
+
+template <class SignalR, class SignalU, class T, size_t N, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, const FixedFir<T, N>& filter, impl::ConvFull) {
+	assert(out.size() == ConvolutionLength(signal.size(), N, CONV_FULL) && "Use ConvolutionLength to calculate output size properly.");
+	Convolution(out, signal, filter, 0);
+}
+
+template <class SignalR, class SignalU, class T, size_t N, class SignalS, std::enable_if_t<is_mutable_signal_v<SignalR> && is_mutable_signal_v<SignalS> && is_same_domain_v<SignalR, SignalU, SignalS>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, const FixedFir<T, N>& filter, SignalS& state) {
+	assert(state.size() == N - 1);
+	assert(out.size() == signal.size());
+
+	Convolution(out, signal, filter, 0);
+	Convolution(AsView(out).subsignal(0, std::min(out.size(), state.size())), state, filter, N - 1, false);
+	impl::ShiftFilterState(state, signal);
+}
+
+template <class SignalU, class T, size_t N>
+auto Filter(const SignalU& signal, const FixedFir<T, N>& filter, impl::ConvCentral) {
+	BasicSignal<multiplies_result_t<typename std::decay_t<SignalU>::value_type, T>, signal_traits<std::decay_t<SignalU>>::domain> out(ConvolutionLength(signal.size(), N, CONV_CENTRAL));
+	Filter(out, signal, filter, CONV_CENTRAL);
+	return out;
+}
+
+template <class SignalU, class T, size_t N>
+auto Filter(const SignalU& signal, const FixedFir<T, N>& filter, impl::ConvFull) {
+	BasicSignal<multiplies_result_t<typename std::decay_t<SignalU>::value_type, T>, signal_traits<std::decay_t<SignalU>>::domain> out(ConvolutionLength(signal.size(), N, CONV_FULL));
+	Filter(out, signal, filter, CONV_FULL);
+	return out;
+}
+
+template <class SignalU, class T, size_t N, class SignalS, std::enable_if_t<is_mutable_signal_v<SignalS> && is_same_domain_v<SignalU, SignalS>, int> = 0>
+auto Filter(const SignalU& signal, const FixedFir<T, N>& filter, SignalS&& state) {
+	BasicSignal<multiplies_result_t<typename std::decay_t<SignalU>::value_type, T>, signal_traits<std::decay_t<SignalU>>::domain> out(signal.size());
+	Filter(out, signal, filter, state);
+	return out;
+}
+
+//------------------------------------------------------------------------------
+// Streaming convolvers that own the filter and its state
+//------------------------------------------------------------------------------
+
+template <class SignalR, class SignalU, class T, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, FftConvolver<T>& convolver) {
+	convolver.process(AsView(out), AsConstView(signal));
+}
+
+template <class SignalR, class SignalU, class T, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, PartitionedConvolver<T>& convolver) {
+	convolver.process(AsView(out), AsConstView(signal));
+}
+
+template <class SignalR, class SignalU, class T, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Filter(SignalR&& out, const SignalU& signal, NonUniformConvolver<T>& convolver) {
+	convolver.process(AsView(out), AsConstView(signal));
+}
+
+template <class SignalU, class T>
+auto Filter(const SignalU& signal, FftConvolver<T>& convolver) {
+	BasicSignal<T, signal_traits<std::decay_t<SignalU>>::domain> out(signal.size());
+	Filter(out, signal, convolver);
+	return out;
+}
+
+template <class SignalU, class T>
+auto Filter(const SignalU& signal, PartitionedConvolver<T>& convolver) {
+	BasicSignal<T, signal_traits<std::decay_t<SignalU>>::domain> out(signal.size());
+	Filter(out, signal, convolver);
+	return out;
+}
+
+template <class SignalU, class T>
+auto Filter(const SignalU& signal, NonUniformConvolver<T>& convolver) {
+	BasicSignal<T, signal_traits<std::decay_t<SignalU>>::domain> out(signal.size());
+	Filter(out, signal, convolver);
+	return out;
+}
+
 } // namespace dspbb
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../../Math/Convolution.hpp"
+#include "../../Primitives/Signal.hpp"
+#include "../../Primitives/SignalView.hpp"
+
+#include <algorithm>
+
+
+namespace dspbb {
+
+/// <summary> Streaming FIR filter that keeps the history of the input stream internally. </summary>
+/// <remarks> The input is appended to a linear buffer behind the last filterSize - 1 samples, and the convolution
+///		kernel runs directly over the buffer, so the history is not shifted on every block. Only when the
+///		buffer fills up is the history moved to its front. Blocks of any size, down to a single sample,
+///		produce the same output. All memory is allocated on construction. </remarks>
+template <class T>
+class FirFilter {
+public:
+	FirFilter() = default;
+	/// <param name="filter"> The impulse response. </param>
+	/// <param name="capacity"> The number of input samples the buffer holds besides the history,
+	///		0 picks a few times the filter size. </param>
+	template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int> = 0>
+	explicit FirFilter(const SignalV& filter, size_t capacity = 0);
+
+	size_t filterSize() const;
+	size_t capacity() const;
+	SignalView<const T> coefficients() const;
+
+	/// <summary> Filters the next block of the input stream. </summary>
+	/// <remarks> Blocks longer than the capacity are split. </remarks>
+	void process(SignalView<T> out, SignalView<const T> in);
+	/// <summary> Clears the history, as if the input stream started from here. </summary>
+	void reset();
+
+private:
+	size_t HistorySize() const;
+
+private:
+	Signal<T> m_filter;
+	Signal<T> m_buffer;
+	size_t m_position = 0;
+};
+
+
+template <class T>
+template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int>>
+FirFilter<T>::FirFilter(const SignalV& filter, size_t capacity)
+	: m_filter(filter.begin(), filter.end()) {
+	assert(!filter.empty());
+	if (capacity == 0) {
+		capacity = std::max(size_t(256), 4 * filter.size());
+	}
+	m_buffer.resize(HistorySize() + capacity, T(0));
+	m_position = HistorySize();
+}
+
+template <class T>
+size_t FirFilter<T>::filterSize() const {
+	return m_filter.size();
+}
+
+template <class T>
+size_t FirFilter<T>::capacity() const {
+	return m_buffer.size() - HistorySize();
+}
+
+template <class T>
+SignalView<const T> FirFilter<T>::coefficients() const {
+	return AsConstView(m_filter);
+}
+
+template <class T>
+void FirFilter<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(out.size() == in.size());
+	const size_t historySize = HistorySize();
+	for (size_t first = 0; first < in.size();) {
+		if (m_position == m_buffer.size()) {
+			std::copy(m_buffer.end() - historySize, m_buffer.end(), m_buffer.begin());
+			m_position = historySize;
+		}
+		const size_t count = std::min(in.size() - first, m_buffer.size() - m_position);
+		std::copy(in.begin() + first, in.begin() + first + count, m_buffer.begin() + m_position);
+
+		// The window starts with the history, so the outputs are the fully overlapped part of its convolution.
+		const auto window = AsConstView(m_buffer).subsignal(m_position - historySize, historySize + count);
+		Convolution(out.subsignal(first, count), window, m_filter, historySize);
+
+		m_position += count;
+		first += count;
+	}
+}
+
+template <class T>
+void FirFilter<T>::reset() {
+	std::fill(m_buffer.begin(), m_buffer.begin() + HistorySize(), T(0));
+	m_position = HistorySize();
+}
+
+template <class T>
+size_t FirFilter<T>::HistorySize() const {
+	return m_filter.size() - 1;
+}
+
+} // namespace dspbb
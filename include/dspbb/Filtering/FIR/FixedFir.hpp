@@ -0,0 +1,58 @@
+#pragma once
+
+#include "../../Kernels/Convolution.hpp"
+#include "../../Math/Convolution.hpp"
+#include "../../Primitives/Signal.hpp"
+#include "../../Primitives/SignalView.hpp"
+
+#include <algorithm>
+#include <array>
+
+
+namespace dspbb {
+
+/// <summary> A filter with a tap count known at compile time. </summary>
+/// <remarks> Filtering with it runs a fully unrolled kernel with the coefficients held in registers,
+///		which avoids the bookkeeping of the general kernels that dominates for short filters. </remarks>
+template <class T, size_t N>
+class FixedFir {
+	static_assert(N > 0, "Filter must have at least one tap.");
+
+public:
+	FixedFir() = default;
+	explicit FixedFir(const std::array<T, N>& coefficients);
+	/// <param name="filter"> The impulse response, must have exactly N taps. </param>
+	template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int> = 0>
+	explicit FixedFir(const SignalV& filter);
+
+	static constexpr size_t size() { return N; }
+	const std::array<T, N>& coefficients() const;
+
+private:
+	std::array<T, N> m_coefficients = {};
+};
+
+
+template <class T, size_t N>
+FixedFir<T, N>::FixedFir(const std::array<T, N>& coefficients) : m_coefficients(coefficients) {}
+
+template <class T, size_t N>
+template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int>>
+FixedFir<T, N>::FixedFir(const SignalV& filter) {
+	assert(filter.size() == N);
+	std::copy(filter.begin(), filter.end(), m_coefficients.begin());
+}
+
+template <class T, size_t N>
+const std::array<T, N>& FixedFir<T, N>::coefficients() const {
+	return m_coefficients;
+}
+
+
+template <class SignalR, class SignalU, class T, size_t N, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Convolution(SignalR&& out, const SignalU& signal, const FixedFir<T, N>& filter, size_t offset, bool clearOut = true) {
+	assert(offset + out.size() <= ConvolutionLength(signal.size(), N, CONV_FULL));
+	kernels::ConvolutionFixed<N>(filter.coefficients().begin(), signal.begin(), signal.end(), out.begin(), out.end(), ptrdiff_t(offset), !clearOut);
+}
+
+} // namespace dspbb
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "../../Math/Convolution.hpp"
+#include "../../Primitives/Signal.hpp"
+#include "../../Primitives/SignalView.hpp"
+#include "../../Utility/TypeTraits.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+
+namespace dspbb {
+
+enum class eSymmetry {
+	SYMMETRIC,
+	ANTISYMMETRIC,
+};
+
+
+/// <summary> Tells if the impulse response is symmetric or antisymmetric around its center. </summary>
+/// <param name="filter"> The impulse response. </param>
+/// <param name="tolerance"> The largest allowed mismatch of mirrored taps, relative to the largest tap. </param>
+/// <returns> The kind of symmetry, or nothing if the filter has neither. </returns>
+template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int> = 0>
+std::optional<eSymmetry> DetectSymmetry(const SignalV& filter, remove_complex_t<typename signal_traits<std::decay_t<SignalV>>::type> tolerance = {}) {
+	using T = typename signal_traits<std::decay_t<SignalV>>::type;
+	using R = remove_complex_t<T>;
+	if (filter.empty()) {
+		return {};
+	}
+
+	R largest = R(0);
+	for (const auto& tap : filter) {
+		largest = std::max(largest, R(std::abs(tap)));
+	}
+	const R limit = tolerance * largest;
+
+	bool symmetric = true;
+	bool antisymmetric = true;
+	const size_t size = filter.size();
+	for (size_t i = 0; i < (size + 1) / 2; ++i) {
+		symmetric = symmetric && R(std::abs(filter[i] - filter[size - 1 - i])) <= limit;
+		antisymmetric = antisymmetric && R(std::abs(filter[i] + filter[size - 1 - i])) <= limit;
+	}
+	if (symmetric) {
+		return eSymmetry::SYMMETRIC;
+	}
+	if (antisymmetric) {
+		return eSymmetry::ANTISYMMETRIC;
+	}
+	return {};
+}
+
+
+/// <summary> A filter with a symmetric or antisymmetric impulse response, stored as the first half of its taps. </summary>
+/// <remarks> Filtering with it adds the pairs of input samples that share a tap before multiplying,
+///		so it takes half the multiplies of filtering with the full impulse response. </remarks>
+template <class T>
+class LinearPhaseFilter {
+public:
+	LinearPhaseFilter() = default;
+	/// <summary> Takes the symmetry from the caller. </summary>
+	/// <param name="halfKernel"> The first (size + 1) / 2 taps of the impulse response. </param>
+	/// <param name="size"> The number of taps of the impulse response. </param>
+	/// <exception cref="std::invalid_argument"> The filter is antisymmetric with an odd size and a non-zero center tap. </exception>
+	template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int> = 0>
+	LinearPhaseFilter(const SignalV& halfKernel, size_t size, eSymmetry symmetry);
+	/// <summary> Detects the symmetry of the impulse response. </summary>
+	/// <exception cref="std::invalid_argument"> The filter is neither symmetric nor antisymmetric. </exception>
+	template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int> = 0>
+	explicit LinearPhaseFilter(const SignalV& filter, remove_complex_t<T> tolerance = 16 * std::numeric_limits<remove_complex_t<T>>::epsilon());
+
+	size_t size() const;
+	eSymmetry symmetry() const;
+	SignalView<const T> halfKernel() const;
+	/// <summary> Returns all taps of the impulse response. </summary>
+	Signal<T> impulseResponse() const;
+
+private:
+	Signal<T> m_halfKernel;
+	size_t m_size = 0;
+	eSymmetry m_symmetry = eSymmetry::SYMMETRIC;
+};
+
+
+template <class T>
+template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int>>
+LinearPhaseFilter<T>::LinearPhaseFilter(const SignalV& halfKernel, size_t size, eSymmetry symmetry)
+	: m_halfKernel(halfKernel.begin(), halfKernel.end()), m_size(size), m_symmetry(symmetry) {
+	assert(size > 0);
+	assert(halfKernel.size() == (size + 1) / 2);
+	if (symmetry == eSymmetry::ANTISYMMETRIC && size % 2 == 1 && m_halfKernel[size / 2] != T(0)) {
+		throw std::invalid_argument("The center tap of an antisymmetric filter must be zero.");
+	}
+}
+
+template <class T>
+template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int>>
+LinearPhaseFilter<T>::LinearPhaseFilter(const SignalV& filter, remove_complex_t<T> tolerance)
+	: m_halfKernel(filter.begin(), filter.begin() + (filter.size() + 1) / 2), m_size(filter.size()) {
+	const auto symmetry = DetectSymmetry(filter, tolerance);
+	if (!symmetry) {
+		throw std::invalid_argument("The filter is neither symmetric nor antisymmetric.");
+	}
+	m_symmetry = *symmetry;
+	if (m_symmetry == eSymmetry::ANTISYMMETRIC && m_size % 2 == 1) {
+		m_halfKernel[m_size / 2] = T(0); // DetectSymmetry only checks it against the tolerance.
+	}
+}
+
+template <class T>
+size_t LinearPhaseFilter<T>::size() const {
+	return m_size;
+}
+
+template <class T>
+eSymmetry LinearPhaseFilter<T>::symmetry() const {
+	return m_symmetry;
+}
+
+template <class T>
+SignalView<const T> LinearPhaseFilter<T>::halfKernel() const {
+	return AsConstView(m_halfKernel);
+}
+
+template <class T>
+Signal<T> LinearPhaseFilter<T>::impulseResponse() const {
+	Signal<T> taps(m_size);
+	std::copy(m_halfKernel.begin(), m_halfKernel.end(), taps.begin());
+	const T sign = m_symmetry == eSymmetry::ANTISYMMETRIC ? T(-1) : T(1);
+	for (size_t i = 0; i < m_size / 2; ++i) {
+		taps[m_size - 1 - i] = sign * m_halfKernel[i];
+	}
+	return taps;
+}
+
+
+template <class SignalR, class SignalU, class T, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalU>, int> = 0>
+void Convolution(SignalR&& out, const SignalU& signal, const LinearPhaseFilter<T>& filter, size_t offset, bool clearOut = true) {
+	assert(offset + out.size() <= ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
+	const auto halfKernel = filter.halfKernel();
+	kernels::ConvolutionSymmetric(halfKernel.begin(), halfKernel.end(), ptrdiff_t(filter.size()), filter.symmetry() == eSymmetry::ANTISYMMETRIC,
+								  signal.begin(), signal.end(), out.begin(), out.end(), ptrdiff_t(offset), !clearOut, plus_compensated<>{});
+}
+
+} // namespace dspbb
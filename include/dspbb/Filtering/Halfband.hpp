@@ -0,0 +1,284 @@
+#pragma once
+
+#include "../Math/Convolution.hpp"
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalView.hpp"
+#include "../Utility/TypeTraits.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+
+namespace dspbb {
+
+namespace impl {
+	// The non-zero taps of a halfband filter. Every second tap is zero, save for the center, so the
+	// impulse response splits into a dense phase that holds every other tap and the lone center tap.
+	template <class T>
+	struct HalfbandTaps {
+		Signal<T> dense;
+		T center = T(0);
+		size_t size = 0;
+		size_t denseParity = 0;
+	};
+
+	template <class T, class SignalV>
+	HalfbandTaps<T> ExtractHalfbandTaps(const SignalV& filter, remove_complex_t<T> tolerance) {
+		using R = remove_complex_t<T>;
+		if (filter.size() < 3 || filter.size() % 2 == 0) {
+			throw std::invalid_argument("Halfband filters must have an odd number of taps, at least 3.");
+		}
+		R largest = R(0);
+		for (const auto& tap : filter) {
+			largest = std::max(largest, R(std::abs(tap)));
+		}
+
+		const size_t center = filter.size() / 2;
+		HalfbandTaps<T> taps;
+		taps.size = filter.size();
+		taps.center = T(filter[center]);
+		taps.denseParity = 1 - center % 2;
+		for (size_t i = center % 2; i < filter.size(); i += 2) {
+			if (i != center && R(std::abs(filter[i])) > tolerance * largest) {
+				throw std::invalid_argument("The filter is not a halfband filter, every second tap except the center must be zero.");
+			}
+		}
+		taps.dense.resize((filter.size() - taps.denseParity + 1) / 2);
+		for (size_t q = 0; q < taps.dense.size(); ++q) {
+			taps.dense[q] = T(filter[taps.denseParity + 2 * q]);
+		}
+		return taps;
+	}
+} // namespace impl
+
+
+/// <summary> Streaming 2:1 decimator with a halfband lowpass filter. </summary>
+/// <remarks> Only the non-zero taps are stored, and only the retained outputs are computed: the input is split into
+///		even and odd samples, one of which is convolved with the dense phase while the other is scaled by the center tap.
+///		This costs about a quarter of the multiplies of filtering with the full impulse response and then decimating.
+///		Blocks must have an even number of samples. All memory is allocated on construction. </remarks>
+template <class T>
+class HalfbandDecimator {
+public:
+	HalfbandDecimator() = default;
+	/// <param name="filter"> The full impulse response of the halfband filter. </param>
+	/// <param name="capacity"> The number of output samples processed in one pass, 0 picks a few times the filter size. </param>
+	/// <param name="tolerance"> The largest allowed magnitude of the zero taps, relative to the largest tap. </param>
+	/// <exception cref="std::invalid_argument"> The filter is not a halfband filter. </exception>
+	template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int> = 0>
+	explicit HalfbandDecimator(const SignalV& filter,
+							   size_t capacity = 0,
+							   remove_complex_t<T> tolerance = 16 * std::numeric_limits<remove_complex_t<T>>::epsilon());
+
+	size_t filterSize() const;
+	/// <summary> The taps of the impulse response with the same parity as the first non-zero tap beside the center. </summary>
+	SignalView<const T> denseTaps() const;
+	T centerTap() const;
+
+	/// <summary> Filters the next block of the input stream and keeps every second sample, starting with the first. </summary>
+	/// <param name="out"> Half as many samples as the input. </param>
+	/// <param name="in"> An even number of samples. </param>
+	void process(SignalView<T> out, SignalView<const T> in);
+	void reset();
+
+private:
+	impl::HalfbandTaps<T> m_taps;
+	Signal<T> m_denseStream;
+	Signal<T> m_centerStream;
+	size_t m_history = 0;
+	size_t m_denseDelay = 0;
+	size_t m_centerDelay = 0;
+	size_t m_position = 0;
+};
+
+
+/// <summary> Streaming 1:2 interpolator with a halfband lowpass filter. </summary>
+/// <remarks> Only the non-zero taps are stored, and the zero-stuffed samples are never multiplied: the outputs of one
+///		parity are the input convolved with the dense phase, those of the other parity are the delayed input scaled by
+///		the center tap. The passband gain is 2 to make up for the inserted zeros, like that of Interpolate. </remarks>
+template <class T>
+class HalfbandInterpolator {
+public:
+	HalfbandInterpolator() = default;
+	/// <param name="filter"> The full impulse response of the halfband filter. </param>
+	/// <param name="capacity"> The number of input samples processed in one pass, 0 picks a few times the filter size. </param>
+	/// <param name="tolerance"> The largest allowed magnitude of the zero taps, relative to the largest tap. </param>
+	/// <exception cref="std::invalid_argument"> The filter is not a halfband filter. </exception>
+	template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int> = 0>
+	explicit HalfbandInterpolator(const SignalV& filter,
+								  size_t capacity = 0,
+								  remove_complex_t<T> tolerance = 16 * std::numeric_limits<remove_complex_t<T>>::epsilon());
+
+	size_t filterSize() const;
+	/// <summary> The taps of the impulse response with the same parity as the first non-zero tap beside the center. </summary>
+	SignalView<const T> denseTaps() const;
+	T centerTap() const;
+
+	/// <summary> Upsamples the next block of the input stream by 2 and filters it. </summary>
+	/// <param name="out"> Twice as many samples as the input. </param>
+	void process(SignalView<T> out, SignalView<const T> in);
+	void reset();
+
+private:
+	impl::HalfbandTaps<T> m_taps;
+	Signal<T> m_stream;
+	Signal<T> m_denseOut;
+	size_t m_history = 0;
+	size_t m_centerDelay = 0;
+	size_t m_position = 0;
+};
+
+
+//------------------------------------------------------------------------------
+// Decimator
+//------------------------------------------------------------------------------
+
+template <class T>
+template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int>>
+HalfbandDecimator<T>::HalfbandDecimator(const SignalV& filter, size_t capacity, remove_complex_t<T> tolerance)
+	: m_taps(impl::ExtractHalfbandTaps<T>(filter, tolerance)) {
+	// With x the input, the even samples x[2j] and the odd samples x[2j + 1] form two low-rate streams.
+	// Output m takes the dense taps from one stream and the center tap from the other, each with a fixed delay.
+	const size_t center = m_taps.size / 2;
+	m_denseDelay = m_taps.denseParity;
+	m_centerDelay = (center + 1) / 2;
+	m_history = std::max(m_taps.dense.size() - 1 + m_denseDelay, m_centerDelay);
+	if (capacity == 0) {
+		capacity = std::max(size_t(256), 4 * m_taps.size);
+	}
+	m_denseStream.resize(m_history + capacity, T(0));
+	m_centerStream.resize(m_history + capacity, T(0));
+	m_position = m_history;
+}
+
+template <class T>
+size_t HalfbandDecimator<T>::filterSize() const {
+	return m_taps.size;
+}
+
+template <class T>
+SignalView<const T> HalfbandDecimator<T>::denseTaps() const {
+	return AsConstView(m_taps.dense);
+}
+
+template <class T>
+T HalfbandDecimator<T>::centerTap() const {
+	return m_taps.center;
+}
+
+template <class T>
+void HalfbandDecimator<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(in.size() % 2 == 0);
+	assert(out.size() == in.size() / 2);
+
+	// The dense taps sit on even indices when the center is odd, so they meet the even samples.
+	const size_t denseInputOffset = m_taps.denseParity == 0 ? 0 : 1;
+	const size_t centerInputOffset = 1 - denseInputOffset;
+	for (size_t first = 0; first < out.size();) {
+		if (m_position == m_denseStream.size()) {
+			std::copy(m_denseStream.end() - m_history, m_denseStream.end(), m_denseStream.begin());
+			std::copy(m_centerStream.end() - m_history, m_centerStream.end(), m_centerStream.begin());
+			m_position = m_history;
+		}
+		const size_t count = std::min(out.size() - first, m_denseStream.size() - m_position);
+		for (size_t i = 0; i < count; ++i) {
+			m_denseStream[m_position + i] = in[2 * (first + i) + denseInputOffset];
+			m_centerStream[m_position + i] = in[2 * (first + i) + centerInputOffset];
+		}
+
+		const auto block = out.subsignal(first, count);
+		const auto denseWindow = AsConstView(m_denseStream).subsignal(m_position - m_history, m_history + count);
+		Convolution(block, denseWindow, m_taps.dense, m_history - m_denseDelay);
+		const auto centerWindow = AsConstView(m_centerStream).subsignal(m_position - m_centerDelay, count);
+		for (size_t i = 0; i < count; ++i) {
+			block[i] += m_taps.center * centerWindow[i];
+		}
+
+		m_position += count;
+		first += count;
+	}
+}
+
+template <class T>
+void HalfbandDecimator<T>::reset() {
+	std::fill(m_denseStream.begin(), m_denseStream.begin() + m_history, T(0));
+	std::fill(m_centerStream.begin(), m_centerStream.begin() + m_history, T(0));
+	m_position = m_history;
+}
+
+
+//------------------------------------------------------------------------------
+// Interpolator
+//------------------------------------------------------------------------------
+
+template <class T>
+template <class SignalV, std::enable_if_t<is_signal_like_v<std::decay_t<SignalV>>, int>>
+HalfbandInterpolator<T>::HalfbandInterpolator(const SignalV& filter, size_t capacity, remove_complex_t<T> tolerance)
+	: m_taps(impl::ExtractHalfbandTaps<T>(filter, tolerance)) {
+	// Output 2m + p of the dense parity p is the input convolved with the dense taps at m,
+	// the output of the other parity meets only the center tap.
+	const size_t center = m_taps.size / 2;
+	m_centerDelay = center / 2;
+	m_history = std::max(m_taps.dense.size() - 1, m_centerDelay);
+	if (capacity == 0) {
+		capacity = std::max(size_t(256), 4 * m_taps.size);
+	}
+	m_stream.resize(m_history + capacity, T(0));
+	m_denseOut.resize(capacity);
+	m_position = m_history;
+}
+
+template <class T>
+size_t HalfbandInterpolator<T>::filterSize() const {
+	return m_taps.size;
+}
+
+template <class T>
+SignalView<const T> HalfbandInterpolator<T>::denseTaps() const {
+	return AsConstView(m_taps.dense);
+}
+
+template <class T>
+T HalfbandInterpolator<T>::centerTap() const {
+	return m_taps.center;
+}
+
+template <class T>
+void HalfbandInterpolator<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(out.size() == 2 * in.size());
+
+	const size_t denseParity = m_taps.denseParity;
+	const size_t centerParity = 1 - denseParity;
+	const T denseGain = T(2);
+	const T centerGain = T(2) * m_taps.center;
+	for (size_t first = 0; first < in.size();) {
+		if (m_position == m_stream.size()) {
+			std::copy(m_stream.end() - m_history, m_stream.end(), m_stream.begin());
+			m_position = m_history;
+		}
+		const size_t count = std::min(in.size() - first, m_stream.size() - m_position);
+		std::copy(in.begin() + first, in.begin() + first + count, m_stream.begin() + m_position);
+
+		const auto denseOut = AsView(m_denseOut).subsignal(0, count);
+		const auto window = AsConstView(m_stream).subsignal(m_position - m_history, m_history + count);
+		Convolution(denseOut, window, m_taps.dense, m_history);
+		const auto centerWindow = AsConstView(m_stream).subsignal(m_position - m_centerDelay, count);
+		for (size_t i = 0; i < count; ++i) {
+			out[2 * (first + i) + denseParity] = denseGain * denseOut[i];
+			out[2 * (first + i) + centerParity] = centerGain * centerWindow[i];
+		}
+
+		m_position += count;
+		first += count;
+	}
+}
+
+template <class T>
+void HalfbandInterpolator<T>::reset() {
+	std::fill(m_stream.begin(), m_stream.begin() + m_history, T(0));
+	m_position = m_history;
+}
+
+} // namespace dspbb
@@ -0,0 +1,398 @@
+#pragma once
+
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalView.hpp"
+#include "../Utility/Numbers.hpp"
+#include "FIR.hpp"
+#include "Resample.hpp"
+#include "Windowing.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+namespace dspbb {
+
+/// <summary> A cascade of integer rate changes found by PlanMultistage. </summary>
+/// <remarks> The stages are listed from the high-rate side. Frequencies are normalized to the Nyquist frequency
+///		of the low sample rate, costs and latencies are counted in high-rate samples. </remarks>
+struct MultistagePlan {
+	size_t ratio = 1;
+	float passband = 0.0f;
+	float attenuation = 0.0f;
+	std::vector<size_t> rates;
+	std::vector<size_t> filterSizes;
+	/// <summary> Multiply-adds per high-rate sample, summed over the stages. </summary>
+	double macsPerSample = 0.0;
+	/// <summary> The group delay of the cascade. </summary>
+	double latency = 0.0;
+};
+
+
+namespace impl {
+	// The edges of one stage in units of the low-rate Nyquist frequency. The stage runs from the sample rate
+	// 2 * remaining down to 2 * remaining / rate. Only the last stage must stop at the low-rate Nyquist frequency,
+	// earlier stages may let the band between the passband and their own output rate minus the low-rate Nyquist
+	// frequency alias, because the later stages remove it.
+	struct MultistageStageEdges {
+		double cutoff;
+		double transition;
+	};
+
+	inline MultistageStageEdges GetMultistageStageEdges(size_t remaining, size_t rate, double passband) {
+		const double stopband = rate == remaining ? 1.0 : 2.0 * double(remaining / rate) - 1.0;
+		const double nyquist = double(remaining);
+		return { (passband + stopband) / 2.0 / nyquist, (stopband - passband) / nyquist };
+	}
+
+	// Kaiser's estimate of the length of a windowed lowpass, made odd for an integer group delay.
+	inline size_t EstimateMultistageFilterSize(double transition, double attenuation) {
+		const double order = std::max(0.0, attenuation - 7.95) / (2.285 * pi_v<double> * transition);
+		const size_t size = size_t(std::ceil(order)) + 1;
+		return std::max(size_t(3), size | 1);
+	}
+
+	inline double KaiserAlpha(double attenuation) {
+		double beta = 0.0;
+		if (attenuation > 50.0) {
+			beta = 0.1102 * (attenuation - 8.7);
+		}
+		else if (attenuation >= 21.0) {
+			beta = 0.5842 * std::pow(attenuation - 21.0, 0.4) + 0.07886 * (attenuation - 21.0);
+		}
+		return beta / pi_v<double>;
+	}
+
+	// Depth-first search over the ordered factorizations of the ratio. The cost and latency only grow as stages
+	// are added, so branches that are already worse than the best complete plan are cut.
+	class MultistageSearch {
+	public:
+		MultistageSearch(size_t ratio, double passband, double attenuation, double maxLatency)
+			: m_passband(passband), m_attenuation(attenuation), m_maxLatency(maxLatency) {
+			for (size_t divisor = 2; divisor <= ratio; ++divisor) {
+				if (ratio % divisor == 0) {
+					m_divisors.push_back(divisor);
+				}
+			}
+		}
+
+		void Run(size_t ratio) {
+			Search(ratio, 1, 0.0, 0.0);
+		}
+
+		bool Found() const { return !m_bestRates.empty(); }
+		const std::vector<size_t>& Rates() const { return m_bestRates; }
+		const std::vector<size_t>& FilterSizes() const { return m_bestSizes; }
+		double Cost() const { return m_bestCost; }
+		double Latency() const { return m_bestLatency; }
+
+	private:
+		void Search(size_t remaining, size_t decimated, double cost, double latency) {
+			if (remaining == 1) {
+				if (cost < m_bestCost) {
+					m_bestCost = cost;
+					m_bestLatency = latency;
+					m_bestRates = m_rates;
+					m_bestSizes = m_sizes;
+				}
+				return;
+			}
+			for (const size_t rate : m_divisors) {
+				if (rate > remaining) {
+					break;
+				}
+				if (remaining % rate != 0) {
+					continue;
+				}
+				const auto edges = GetMultistageStageEdges(remaining, rate, m_passband);
+				const size_t size = EstimateMultistageFilterSize(edges.transition, m_attenuation);
+				const double stageCost = cost + double(size) / double(decimated * rate);
+				const double stageLatency = latency + double(size - 1) / 2.0 * double(decimated);
+				if (stageCost >= m_bestCost || stageLatency > m_maxLatency) {
+					continue;
+				}
+				m_rates.push_back(rate);
+				m_sizes.push_back(size);
+				Search(remaining / rate, decimated * rate, stageCost, stageLatency);
+				m_rates.pop_back();
+				m_sizes.pop_back();
+			}
+		}
+
+	private:
+		double m_passband;
+		double m_attenuation;
+		double m_maxLatency;
+		std::vector<size_t> m_divisors;
+		std::vector<size_t> m_rates;
+		std::vector<size_t> m_sizes;
+		std::vector<size_t> m_bestRates;
+		std::vector<size_t> m_bestSizes;
+		double m_bestCost = std::numeric_limits<double>::infinity();
+		double m_bestLatency = 0.0;
+	};
+
+	// Designs the lowpass of a stage at its high sample rate with a Kaiser window that meets the attenuation.
+	template <class T>
+	Signal<T> DesignMultistageFilter(const MultistagePlan& plan, size_t stage) {
+		size_t remaining = 1;
+		for (size_t i = stage; i < plan.rates.size(); ++i) {
+			remaining *= plan.rates[i];
+		}
+		const auto edges = GetMultistageStageEdges(remaining, plan.rates[stage], plan.passband);
+		const auto window = windows::kaiser.alpha(KaiserAlpha(plan.attenuation));
+		return DesignFilter<T, TIME_DOMAIN>(plan.filterSizes[stage], Fir.Lowpass.Windowed.Cutoff(float(edges.cutoff)).Window(window));
+	}
+} // namespace impl
+
+
+/// <summary> Finds the cheapest cascade of integer rate changes for decimating or interpolating by ratio. </summary>
+/// <remarks> Every ordered factorization of the ratio is considered. The length of each stage's lowpass is estimated
+///		by Kaiser's formula from the attenuation and the stage's transition band, which is wide for the early stages of a
+///		decimator, since they only have to keep aliases out of the final passband. The plan with the fewest multiply-adds
+///		per high-rate sample that fits into the latency budget is returned. The same plan serves decimation and,
+///		in reverse, interpolation. </remarks>
+/// <param name="ratio"> The ratio of the high and low sample rates, at least 2. </param>
+/// <param name="passband"> The edge of the passband, normalized to the low-rate Nyquist frequency. </param>
+/// <param name="attenuation"> The stopband attenuation of every stage in decibels. </param>
+/// <param name="maxLatency"> The largest allowed group delay in high-rate samples. </param>
+/// <exception cref="std::invalid_argument"> The parameters are out of range or no plan meets the latency budget. </exception>
+inline MultistagePlan PlanMultistage(size_t ratio,
+									 float passband,
+									 float attenuation,
+									 double maxLatency = std::numeric_limits<double>::infinity()) {
+	if (ratio < 2) {
+		throw std::invalid_argument("Multistage resampling needs a ratio of at least 2.");
+	}
+	if (!(0.0f < passband && passband < 1.0f)) {
+		throw std::invalid_argument("The passband must be between zero and the low-rate Nyquist frequency.");
+	}
+	if (!(attenuation > 0.0f)) {
+		throw std::invalid_argument("The stopband attenuation must be positive.");
+	}
+
+	impl::MultistageSearch search{ ratio, passband, attenuation, maxLatency };
+	search.Run(ratio);
+	if (!search.Found()) {
+		throw std::invalid_argument("No multistage plan meets the latency budget.");
+	}
+
+	MultistagePlan plan;
+	plan.ratio = ratio;
+	plan.passband = passband;
+	plan.attenuation = attenuation;
+	plan.rates = search.Rates();
+	plan.filterSizes = search.FilterSizes();
+	plan.macsPerSample = search.Cost();
+	plan.latency = search.Latency();
+	return plan;
+}
+
+
+/// <summary> Streaming decimator that runs a cascade of polyphase FilterDecimate stages. </summary>
+/// <remarks> Blocks must be a multiple of the ratio. The unity gain lowpass of each stage is designed on construction. </remarks>
+template <class T>
+class MultistageDecimator {
+public:
+	MultistageDecimator() = default;
+	explicit MultistageDecimator(MultistagePlan plan);
+	/// <summary> Plans and builds the cheapest decimator, see PlanMultistage. </summary>
+	MultistageDecimator(size_t ratio, float passband, float attenuation, double maxLatency = std::numeric_limits<double>::infinity());
+
+	const MultistagePlan& plan() const;
+	size_t ratio() const;
+	size_t numStages() const;
+	size_t stageRate(size_t stage) const;
+	SignalView<const T> stageFilter(size_t stage) const;
+
+	/// <param name="out"> Must have in.size() / ratio() samples. </param>
+	/// <param name="in"> A multiple of ratio() samples. </param>
+	void process(SignalView<T> out, SignalView<const T> in);
+	void reset();
+
+private:
+	MultistagePlan m_plan;
+	std::vector<Signal<T>> m_filters;
+	std::vector<Signal<T>> m_states;
+	Signal<T> m_buffers[2];
+};
+
+
+/// <summary> Streaming interpolator that runs a cascade of polyphase FilterInterpolate stages. </summary>
+/// <remarks> The stages of the plan run in reverse, from the low-rate side. Each stage's lowpass is scaled
+///		by its rate, so that the cascade has unity passband gain. </remarks>
+template <class T>
+class MultistageInterpolator {
+public:
+	MultistageInterpolator() = default;
+	explicit MultistageInterpolator(MultistagePlan plan);
+	/// <summary> Plans and builds the cheapest interpolator, see PlanMultistage. </summary>
+	MultistageInterpolator(size_t ratio, float passband, float attenuation, double maxLatency = std::numeric_limits<double>::infinity());
+
+	const MultistagePlan& plan() const;
+	size_t ratio() const;
+	size_t numStages() const;
+	/// <summary> The rate of the stage-th stage of the plan, counted from the high-rate side. </summary>
+	size_t stageRate(size_t stage) const;
+	SignalView<const T> stageFilter(size_t stage) const;
+
+	/// <param name="out"> Must have in.size() * ratio() samples. </param>
+	void process(SignalView<T> out, SignalView<const T> in);
+	void reset();
+
+private:
+	MultistagePlan m_plan;
+	std::vector<Signal<T>> m_filters;
+	std::vector<Signal<T>> m_states;
+	Signal<T> m_buffers[2];
+};
+
+
+//------------------------------------------------------------------------------
+// Decimator
+//------------------------------------------------------------------------------
+
+template <class T>
+MultistageDecimator<T>::MultistageDecimator(MultistagePlan plan) : m_plan(std::move(plan)) {
+	for (size_t stage = 0; stage < m_plan.rates.size(); ++stage) {
+		m_filters.push_back(impl::DesignMultistageFilter<T>(m_plan, stage));
+		m_states.emplace_back(m_filters.back().size() - 1, T(0));
+	}
+}
+
+template <class T>
+MultistageDecimator<T>::MultistageDecimator(size_t ratio, float passband, float attenuation, double maxLatency)
+	: MultistageDecimator(PlanMultistage(ratio, passband, attenuation, maxLatency)) {}
+
+template <class T>
+const MultistagePlan& MultistageDecimator<T>::plan() const {
+	return m_plan;
+}
+
+template <class T>
+size_t MultistageDecimator<T>::ratio() const {
+	return m_plan.ratio;
+}
+
+template <class T>
+size_t MultistageDecimator<T>::numStages() const {
+	return m_plan.rates.size();
+}
+
+template <class T>
+size_t MultistageDecimator<T>::stageRate(size_t stage) const {
+	return m_plan.rates[stage];
+}
+
+template <class T>
+SignalView<const T> MultistageDecimator<T>::stageFilter(size_t stage) const {
+	return AsConstView(m_filters[stage]);
+}
+
+template <class T>
+void MultistageDecimator<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(in.size() % ratio() == 0);
+	assert(out.size() == in.size() / ratio());
+
+	SignalView<const T> stageInput = in;
+	for (size_t stage = 0; stage < numStages(); ++stage) {
+		const size_t rate = m_plan.rates[stage];
+		const size_t outputSize = stageInput.size() / rate;
+		SignalView<T> stageOutput = out;
+		if (stage + 1 < numStages()) {
+			auto& buffer = m_buffers[stage % 2];
+			if (buffer.size() < outputSize) {
+				buffer.resize(outputSize);
+			}
+			stageOutput = AsView(buffer).subsignal(0, outputSize);
+		}
+		FilterDecimate(stageOutput, stageInput, m_filters[stage], rate, m_states[stage]);
+		stageInput = stageOutput;
+	}
+}
+
+template <class T>
+void MultistageDecimator<T>::reset() {
+	for (auto& state : m_states) {
+		std::fill(state.begin(), state.end(), T(0));
+	}
+}
+
+
+//------------------------------------------------------------------------------
+// Interpolator
+//------------------------------------------------------------------------------
+
+template <class T>
+MultistageInterpolator<T>::MultistageInterpolator(MultistagePlan plan) : m_plan(std::move(plan)) {
+	for (size_t stage = 0; stage < m_plan.rates.size(); ++stage) {
+		const size_t rate = m_plan.rates[stage];
+		m_filters.push_back(impl::DesignMultistageFilter<T>(m_plan, stage));
+		m_filters.back() *= T(rate);
+		m_states.emplace_back((m_filters.back().size() + rate - 1) / rate - 1, T(0));
+	}
+}
+
+template <class T>
+MultistageInterpolator<T>::MultistageInterpolator(size_t ratio, float passband, float attenuation, double maxLatency)
+	: MultistageInterpolator(PlanMultistage(ratio, passband, attenuation, maxLatency)) {}
+
+template <class T>
+const MultistagePlan& MultistageInterpolator<T>::plan() const {
+	return m_plan;
+}
+
+template <class T>
+size_t MultistageInterpolator<T>::ratio() const {
+	return m_plan.ratio;
+}
+
+template <class T>
+size_t MultistageInterpolator<T>::numStages() const {
+	return m_plan.rates.size();
+}
+
+template <class T>
+size_t MultistageInterpolator<T>::stageRate(size_t stage) const {
+	return m_plan.rates[stage];
+}
+
+template <class T>
+SignalView<const T> MultistageInterpolator<T>::stageFilter(size_t stage) const {
+	return AsConstView(m_filters[stage]);
+}
+
+template <class T>
+void MultistageInterpolator<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(out.size() == in.size() * ratio());
+
+	SignalView<const T> stageInput = in;
+	for (size_t step = 0; step < numStages(); ++step) {
+		const size_t stage = numStages() - 1 - step;
+		const size_t rate = m_plan.rates[stage];
+		const size_t outputSize = stageInput.size() * rate;
+		SignalView<T> stageOutput = out;
+		if (stage > 0) {
+			auto& buffer = m_buffers[step % 2];
+			if (buffer.size() < outputSize) {
+				buffer.resize(outputSize);
+			}
+			stageOutput = AsView(buffer).subsignal(0, outputSize);
+		}
+		FilterInterpolate(stageOutput, stageInput, m_filters[stage], rate, m_states[stage]);
+		stageInput = stageOutput;
+	}
+}
+
+template <class T>
+void MultistageInterpolator<T>::reset() {
+	for (auto& state : m_states) {
+		std::fill(state.begin(), state.end(), T(0));
+	}
+}
+
+} // namespace dspbb
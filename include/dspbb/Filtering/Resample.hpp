@@ -187,6 +187,74 @@ auto Decimate(const SignalT& input, size_t rate) {
 }
 
 
+/// <summary> Filters the next block of a stream, then keeps every rate-th sample of the result, starting with the first. </summary>
+/// <remarks> Only the retained samples are computed. The filter is split into rate phases and the stream into the
+///		same number of low-rate streams, so each phase is a convolution at the low rate that costs filter.size() / rate
+///		multiply-adds per output. Use blocks that are multiples of rate to keep the decimated stream evenly spaced. </remarks>
+/// <param name="state"> The last filter.size() - 1 samples of the previous blocks, updated on return. </param>
+template <class SignalR,
+		  class SignalT,
+		  class SignalV,
+		  class SignalS,
+		  std::enable_if_t<is_mutable_signal_v<SignalR> && is_mutable_signal_v<SignalS> && is_same_domain_v<SignalR, SignalT, SignalV, SignalS>, int> = 0>
+void FilterDecimate(SignalR&& output,
+					const SignalT& input,
+					const SignalV& filter,
+					size_t rate,
+					SignalS& state) {
+	assert(rate > 0);
+	assert(!filter.empty());
+	assert(state.size() == filter.size() - 1);
+	assert(output.size() == (input.size() + rate - 1) / rate);
+
+	using T = std::remove_const_t<typename signal_traits<std::decay_t<SignalT>>::type>;
+	using V = std::remove_const_t<typename signal_traits<std::decay_t<SignalV>>::type>;
+	using R = typename signal_traits<std::decay_t<SignalR>>::type;
+	constexpr auto domain = signal_traits<std::decay_t<SignalT>>::domain;
+
+	// The stream is the state followed by the input, output m is the filtered stream at historySize + m * rate.
+	const size_t historySize = state.size();
+	const size_t streamSize = historySize + input.size();
+	const auto streamSample = [&](size_t index) { return index < historySize ? T(state[index]) : T(input[index - historySize]); };
+
+	std::fill(output.begin(), output.end(), R(remove_complex_t<R>(0)));
+	if (!output.empty()) {
+		BasicSignal<T, domain> phaseInputBuffer((streamSize + rate - 1) / rate);
+		BasicSignal<V, domain> phaseFilterBuffer((filter.size() + rate - 1) / rate);
+		for (size_t phase = 0; phase < std::min(rate, filter.size()); ++phase) {
+			// Tap phase + q * rate meets the stream at historySize - phase + (m - q) * rate, so the low-rate
+			// stream of this phase starts at the remainder and the quotient is the offset of the convolution.
+			const size_t phaseSize = (filter.size() - phase + rate - 1) / rate;
+			const size_t first = (historySize - phase) % rate;
+			const size_t offset = (historySize - phase) / rate;
+
+			const auto phaseFilter = AsView(phaseFilterBuffer).subsignal(0, phaseSize);
+			for (size_t q = 0; q < phaseSize; ++q) {
+				phaseFilter[q] = filter[phase + q * rate];
+			}
+			const auto phaseInput = AsView(phaseInputBuffer).subsignal(0, (streamSize - first + rate - 1) / rate);
+			for (size_t i = 0; i < phaseInput.size(); ++i) {
+				phaseInput[i] = streamSample(first + i * rate);
+			}
+			Convolution(output, phaseInput, phaseFilter, offset, false);
+		}
+	}
+	impl::ShiftFilterState(state, input);
+}
+
+
+template <class SignalT, class SignalV, class SignalS, std::enable_if_t<is_mutable_signal_v<SignalS> && is_same_domain_v<SignalT, SignalV, SignalS>, int> = 0>
+auto FilterDecimate(const SignalT& input, const SignalV& filter, size_t rate, SignalS& state) {
+	using T = typename signal_traits<std::decay_t<SignalT>>::type;
+	using V = typename signal_traits<std::decay_t<SignalV>>::type;
+	using R = std::remove_const_t<multiplies_result_t<T, V>>;
+	constexpr auto domain = signal_traits<std::decay_t<SignalT>>::domain;
+	BasicSignal<R, domain> output((input.size() + rate - 1) / rate);
+	FilterDecimate(output, input, filter, rate, state);
+	return output;
+}
+
+
 template <class SignalR,
 		  class SignalT,
 		  std::enable_if_t<is_same_domain_v<SignalR, SignalT> && is_mutable_signal_v<SignalR>, int> = 0>
@@ -215,6 +283,73 @@ auto Expand(const SignalT& input, size_t rate) {
 }
 
 
+/// <summary> Inserts rate - 1 zeros after each sample of the next block of a stream, then filters the result. </summary>
+/// <remarks> The zeros are never multiplied. Output phase p takes every rate-th tap of the filter starting at p, so each
+///		phase is a convolution at the low rate that costs filter.size() / rate multiply-adds per output.
+///		Like Expand followed by a filter, the passband gain is 1 / rate. </remarks>
+/// <param name="state"> The last (filter.size() + rate - 1) / rate - 1 samples of the previous blocks, updated on return. </param>
+template <class SignalR,
+		  class SignalT,
+		  class SignalV,
+		  class SignalS,
+		  std::enable_if_t<is_mutable_signal_v<SignalR> && is_mutable_signal_v<SignalS> && is_same_domain_v<SignalR, SignalT, SignalV, SignalS>, int> = 0>
+void FilterInterpolate(SignalR&& output,
+					   const SignalT& input,
+					   const SignalV& filter,
+					   size_t rate,
+					   SignalS& state) {
+	assert(rate > 0);
+	assert(!filter.empty());
+	assert(state.size() == (filter.size() + rate - 1) / rate - 1);
+	assert(output.size() == input.size() * rate);
+
+	using T = std::remove_const_t<typename signal_traits<std::decay_t<SignalT>>::type>;
+	using V = std::remove_const_t<typename signal_traits<std::decay_t<SignalV>>::type>;
+	using R = typename signal_traits<std::decay_t<SignalR>>::type;
+	constexpr auto domain = signal_traits<std::decay_t<SignalT>>::domain;
+
+	// The stream is the state followed by the input, output m * rate + p is the stream at historySize + m
+	// convolved with the taps p + q * rate.
+	const size_t historySize = state.size();
+	if (!input.empty()) {
+		BasicSignal<T, domain> stream(historySize + input.size());
+		std::copy(state.begin(), state.end(), stream.begin());
+		std::copy(input.begin(), input.end(), stream.begin() + historySize);
+		BasicSignal<V, domain> phaseFilterBuffer(historySize + 1);
+		BasicSignal<R, domain> phaseOutput(input.size());
+		for (size_t phase = 0; phase < rate; ++phase) {
+			const size_t phaseSize = phase < filter.size() ? (filter.size() - phase + rate - 1) / rate : 0;
+			if (phaseSize == 0) {
+				std::fill(phaseOutput.begin(), phaseOutput.end(), R(remove_complex_t<R>(0)));
+			}
+			else {
+				const auto phaseFilter = AsView(phaseFilterBuffer).subsignal(0, phaseSize);
+				for (size_t q = 0; q < phaseSize; ++q) {
+					phaseFilter[q] = filter[phase + q * rate];
+				}
+				Convolution(phaseOutput, stream, phaseFilter, historySize);
+			}
+			for (size_t m = 0; m < phaseOutput.size(); ++m) {
+				output[m * rate + phase] = phaseOutput[m];
+			}
+		}
+	}
+	impl::ShiftFilterState(state, input);
+}
+
+
+template <class SignalT, class SignalV, class SignalS, std::enable_if_t<is_mutable_signal_v<SignalS> && is_same_domain_v<SignalT, SignalV, SignalS>, int> = 0>
+auto FilterInterpolate(const SignalT& input, const SignalV& filter, size_t rate, SignalS& state) {
+	using T = typename signal_traits<std::decay_t<SignalT>>::type;
+	using V = typename signal_traits<std::decay_t<SignalV>>::type;
+	using R = std::remove_const_t<multiplies_result_t<T, V>>;
+	constexpr auto domain = signal_traits<std::decay_t<SignalT>>::domain;
+	BasicSignal<R, domain> output(input.size() * rate);
+	FilterInterpolate(output, input, filter, rate, state);
+	return output;
+}
+
+
 template <class SignalR,
 		  class SignalT,
 		  class P,
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "../Utility/CacheSizes.hpp"
 #include "../Utility/Interval.hpp"
 #include "Math.hpp"
 #include "Numeric.hpp"
 #include "Utility.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <iterator>
 #include <utility>
@@ -100,8 +103,6 @@ void ConvolutionSlide(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Iter
 
 template <class Iter1, class Iter2, class IterOut>
 void ConvolutionReduce(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, IterOut firstOut, IterOut lastOut, ptrdiff_t n, bool accumulate = false) {
-	assert(accumulate == false); // Accumulate is not implemented in this function yet, so better make sure it's not misused.
-
 	const ptrdiff_t len1 = std::distance(first1, last1);
 	const ptrdiff_t len2 = std::distance(first2, last2);
 
@@ -109,10 +110,14 @@ void ConvolutionReduce(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Ite
 	using OutT = typename std::iterator_traits<IterOut>::value_type;
 
 	for (; firstOut < lastOut; n += vectorWidth) {
+		const ptrdiff_t iterationWidth = std::min(ptrdiff_t(lastOut - firstOut), vectorWidth);
 		std::array<OutT, vectorWidth> accumulator;
 		std::array<OutT, vectorWidth> data;
 		std::fill(accumulator.begin(), accumulator.end(), OutT(0));
 		std::fill(data.begin(), data.end(), OutT(0));
+		if (accumulate) {
+			std::copy(firstOut, firstOut + iterationWidth, accumulator.begin());
+		}
 
 		ptrdiff_t mFirst = std::max(ptrdiff_t(0), n - len2 + 1);
 		ptrdiff_t mLast = std::min(len1, n + vectorWidth);
@@ -127,9 +132,7 @@ void ConvolutionReduce(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Ite
 			}
 		}
 
-		for (size_t i = 0; i < vectorWidth && firstOut < lastOut; ++i, ++firstOut) {
-			*firstOut = accumulator[i];
-		}
+		firstOut = std::copy(accumulator.begin(), accumulator.begin() + iterationWidth, firstOut);
 	}
 }
 
@@ -236,4 +239,364 @@ void ConvolutionReduceVec(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2,
 	}
 }
 
+
+// Computes BlockSize vectors of outputs at once, keeping their accumulators in registers. Each coefficient
+// of the shorter input is loaded once and reused for all the accumulators of the block. Blocks that would
+// run off the edge of the longer input, where the number of terms varies, fall back to ConvolutionReduceVec.
+template <ptrdiff_t BlockSize = 4, class Iter1, class Iter2, class IterOut, class ReduceOp = plus_compensated<>>
+void ConvolutionReduceBlocked(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, IterOut firstOut, IterOut lastOut, ptrdiff_t n, bool accumulate = false, ReduceOp reduceOp = plus_compensated<>{}) {
+	using T1 = typename std::iterator_traits<Iter1>::value_type;
+	using T2 = typename std::iterator_traits<Iter2>::value_type;
+	using OutT = typename std::iterator_traits<IterOut>::value_type;
+
+	constexpr bool isVectorized = is_convolution_reduce_vectorized<T1, T2, OutT>::value;
+	constexpr ptrdiff_t vectorWidth = isVectorized ? xsimd::simd_traits<OutT>::size : 1;
+	constexpr ptrdiff_t blockWidth = BlockSize * vectorWidth;
+	using OutV = std::conditional_t<isVectorized, xsimd::simd_type<OutT>, OutT>;
+	using V1 = std::conditional_t<isVectorized, xsimd::simd_type<T1>, T1>;
+	using V2 = std::conditional_t<isVectorized, xsimd::simd_type<T2>, T2>;
+
+	const ptrdiff_t len1 = std::distance(first1, last1);
+	const ptrdiff_t len2 = std::distance(first2, last2);
+	const ptrdiff_t lenOut = std::distance(firstOut, lastOut);
+
+	if (len2 < len1) {
+		return ConvolutionReduceBlocked<BlockSize>(first2, last2, first1, last1, firstOut, lastOut, n, accumulate, reduceOp);
+	}
+
+	// Outputs in [interiorFirst, interiorLast) take all len1 terms, and none of them index outside input #2.
+	const ptrdiff_t interiorFirst = std::clamp(len1 - 1 - n, ptrdiff_t(0), lenOut);
+	const ptrdiff_t interiorLast = std::max(interiorFirst, std::min(lenOut, len2 - n));
+	const ptrdiff_t blockedLast = interiorFirst + (interiorLast - interiorFirst) / blockWidth * blockWidth;
+
+	ConvolutionReduceVec(first1, last1, first2, last2, firstOut, firstOut + interiorFirst, n, accumulate, reduceOp);
+	ConvolutionReduceVec(first1, last1, first2, last2, firstOut + blockedLast, lastOut, n + blockedLast, accumulate, reduceOp);
+
+	for (ptrdiff_t outIdx = interiorFirst; outIdx < blockedLast; outIdx += blockWidth) {
+		std::array<OutV, BlockSize> accumulators;
+		for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+			accumulators[b] = accumulate ? uniform_load_unaligned<OutV>(std::addressof(*(firstOut + outIdx + b * vectorWidth))) : OutV(OutT(0));
+		}
+		[[maybe_unused]] std::array<decltype(make_compensation_carry<OutV, multiplies_result_t<V1, V2>>(reduceOp, accumulators[0])), BlockSize> carries;
+		if constexpr (is_operator_compensated_v<ReduceOp>) {
+			for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+				carries[b] = make_compensation_carry<OutV, multiplies_result_t<V1, V2>>(reduceOp, accumulators[b]);
+			}
+		}
+
+		// Input #2 is read backwards from the position of the first output of the block.
+		const auto base2 = first2 + (n + outIdx);
+		ptrdiff_t m = 0;
+		for (; m + 4 <= len1; m += 4) {
+			const V1 c0(first1[m]);
+			const V1 c1(first1[m + 1]);
+			const V1 c2(first1[m + 2]);
+			const V1 c3(first1[m + 3]);
+			for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+				const auto lane = base2 + (b * vectorWidth - m);
+				const auto v0 = c0 * uniform_load_unaligned<V2>(std::addressof(*lane));
+				const auto v1 = c1 * uniform_load_unaligned<V2>(std::addressof(*(lane - 1)));
+				const auto v2 = c2 * uniform_load_unaligned<V2>(std::addressof(*(lane - 2)));
+				const auto v3 = c3 * uniform_load_unaligned<V2>(std::addressof(*(lane - 3)));
+				if constexpr (is_operator_compensated_v<ReduceOp>) {
+					accumulators[b] = reduceOp(carries[b], accumulators[b], (v0 + v1) + (v2 + v3));
+				}
+				else {
+					accumulators[b] = reduceOp(accumulators[b], (v0 + v1) + (v2 + v3));
+				}
+			}
+		}
+		for (; m < len1; ++m) {
+			const V1 c(first1[m]);
+			for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+				accumulators[b] += c * uniform_load_unaligned<V2>(std::addressof(*(base2 + (b * vectorWidth - m))));
+			}
+		}
+
+		for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+			uniform_store_unaligned(std::addressof(*(firstOut + outIdx + b * vectorWidth)), accumulators[b]);
+		}
+	}
+}
+
+// Splits the outputs and the shorter input into tiles, and convolves each pair of tiles with ConvolutionReduceBlocked.
+// The working set of a pair is outputTile outputs, filterTile coefficients and the outputTile + filterTile samples
+// of the longer input they touch, which stays in cache even when the shorter input as a whole does not.
+template <class Iter1, class Iter2, class IterOut, class ReduceOp = plus_compensated<>>
+void ConvolutionReduceTiled(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, IterOut firstOut, IterOut lastOut, ptrdiff_t n, ptrdiff_t outputTile, ptrdiff_t filterTile, bool accumulate = false, ReduceOp reduceOp = plus_compensated<>{}) {
+	using OutT = typename std::iterator_traits<IterOut>::value_type;
+	assert(outputTile > 0 && filterTile > 0);
+
+	const ptrdiff_t len1 = std::distance(first1, last1);
+	const ptrdiff_t len2 = std::distance(first2, last2);
+	const ptrdiff_t lenOut = std::distance(firstOut, lastOut);
+
+	if (len2 < len1) {
+		return ConvolutionReduceTiled(first2, last2, first1, last1, firstOut, lastOut, n, outputTile, filterTile, accumulate, reduceOp);
+	}
+
+	if (!accumulate) {
+		std::fill(firstOut, lastOut, OutT(0));
+	}
+
+	for (ptrdiff_t outFirst = 0; outFirst < lenOut; outFirst += outputTile) {
+		const ptrdiff_t outLast = std::min(lenOut, outFirst + outputTile);
+		for (ptrdiff_t filterFirst = 0; filterFirst < len1; filterFirst += filterTile) {
+			const ptrdiff_t filterLast = std::min(len1, filterFirst + filterTile);
+			// The tile of coefficients only reaches the outputs of the full convolution of itself and input #2, shifted by filterFirst.
+			const Interval reach = Intersection(Interval{ n + outFirst, n + outLast }, Interval{ filterFirst, filterLast + len2 - 1 });
+			if (reach.size() > 0) {
+				ConvolutionReduceBlocked(first1 + filterFirst, first1 + filterLast, first2, last2,
+										 firstOut + (reach.first - n), firstOut + (reach.last - n), reach.first - filterFirst, true, reduceOp);
+			}
+		}
+	}
+}
+
+// Outputs and coefficients per tile, so that a pair of tiles and the samples they read fill about half of the L1 cache.
+template <class T1, class OutT>
+std::pair<ptrdiff_t, ptrdiff_t> ConvolutionTileSizes(const CacheSizes& cacheSizes) {
+	const ptrdiff_t outputTile = std::max(ptrdiff_t(64), ptrdiff_t(cacheSizes.l1 / (4 * sizeof(OutT))));
+	const ptrdiff_t filterTile = std::max(ptrdiff_t(64), ptrdiff_t(cacheSizes.l1 / (8 * sizeof(T1))));
+	return { outputTile, filterTile };
+}
+
+
+template <class V2, class OutV, class V1, class Iter2, size_t... K>
+OutV ConvolutionFixedDot(const std::array<V1, sizeof...(K)>& coefficients, Iter2 position, OutV init, std::index_sequence<K...>) {
+	return (init + ... + (coefficients[K] * uniform_load_unaligned<V2>(std::addressof(*(position - ptrdiff_t(K))))));
+}
+
+// Convolves with exactly N coefficients starting at first1. The coefficients are broadcast once and kept in
+// registers, and the loop over them is fully unrolled, so the outputs cost N multiply-adds per vector and
+// nothing else. Two output vectors are computed at once to hide the latency of the accumulation chain.
+// Outputs that index outside input #2 fall back to ConvolutionNaive.
+template <size_t N, class Iter1, class Iter2, class IterOut>
+void ConvolutionFixed(Iter1 first1, Iter2 first2, Iter2 last2, IterOut firstOut, IterOut lastOut, ptrdiff_t n, bool accumulate = false) {
+	static_assert(N > 0);
+	using T1 = typename std::iterator_traits<Iter1>::value_type;
+	using T2 = typename std::iterator_traits<Iter2>::value_type;
+	using OutT = typename std::iterator_traits<IterOut>::value_type;
+
+	constexpr bool isVectorized = is_convolution_reduce_vectorized<T1, T2, OutT>::value;
+	constexpr ptrdiff_t vectorWidth = isVectorized ? xsimd::simd_traits<OutT>::size : 1;
+	constexpr ptrdiff_t len1 = ptrdiff_t(N);
+	using OutV = std::conditional_t<isVectorized, xsimd::simd_type<OutT>, OutT>;
+	using V1 = std::conditional_t<isVectorized, xsimd::simd_type<T1>, T1>;
+	using V2 = std::conditional_t<isVectorized, xsimd::simd_type<T2>, T2>;
+
+	const ptrdiff_t len2 = std::distance(first2, last2);
+	const ptrdiff_t lenOut = std::distance(firstOut, lastOut);
+
+	const ptrdiff_t interiorFirst = std::clamp(len1 - 1 - n, ptrdiff_t(0), lenOut);
+	const ptrdiff_t interiorLast = std::max(interiorFirst, std::min(lenOut, len2 - n));
+	const ptrdiff_t vectorizedLast = interiorFirst + (interiorLast - interiorFirst) / vectorWidth * vectorWidth;
+
+	ConvolutionNaive(first1, first1 + len1, first2, last2, firstOut, firstOut + interiorFirst, n, accumulate);
+	ConvolutionNaive(first1, first1 + len1, first2, last2, firstOut + vectorizedLast, lastOut, n + vectorizedLast, accumulate);
+
+	std::array<V1, N> coefficients;
+	for (size_t k = 0; k < N; ++k) {
+		coefficients[k] = V1(first1[k]);
+	}
+
+	constexpr auto indices = std::make_index_sequence<N>{};
+	const auto load = [&](ptrdiff_t outIdx) {
+		return accumulate ? uniform_load_unaligned<OutV>(std::addressof(*(firstOut + outIdx))) : OutV(OutT(0));
+	};
+	ptrdiff_t outIdx = interiorFirst;
+	for (; outIdx + 2 * vectorWidth <= vectorizedLast; outIdx += 2 * vectorWidth) {
+		const auto position = first2 + (n + outIdx);
+		const OutV acc0 = ConvolutionFixedDot<V2>(coefficients, position, load(outIdx), indices);
+		const OutV acc1 = ConvolutionFixedDot<V2>(coefficients, position + vectorWidth, load(outIdx + vectorWidth), indices);
+		uniform_store_unaligned(std::addressof(*(firstOut + outIdx)), acc0);
+		uniform_store_unaligned(std::addressof(*(firstOut + outIdx + vectorWidth)), acc1);
+	}
+	for (; outIdx < vectorizedLast; outIdx += vectorWidth) {
+		const OutV acc = ConvolutionFixedDot<V2>(coefficients, first2 + (n + outIdx), load(outIdx), indices);
+		uniform_store_unaligned(std::addressof(*(firstOut + outIdx)), acc);
+	}
+}
+
+
+enum class eConvolutionKernel {
+	NAIVE,
+	SLIDE,
+	REDUCE,
+	REDUCE_VEC,
+	REDUCE_BLOCKED,
+	REDUCE_TILED,
+};
+
+// Slided is faster, but it's accuracy degrades for large input and a compensated reduction is better.
+// For mid-size filters, blocking the reduction over several output vectors saves most of the filter reloads.
+// Filters that don't fit in L1 are also tiled, so that the reloads hit the cache.
+inline eConvolutionKernel SelectConvolutionKernel(ptrdiff_t len1, ptrdiff_t len2) {
+	const ptrdiff_t shorterSize = std::min(len1, len2);
+	if (shorterSize <= 32) {
+		return eConvolutionKernel::SLIDE;
+	}
+	if (shorterSize <= 512) {
+		return eConvolutionKernel::REDUCE_BLOCKED;
+	}
+	if (shorterSize <= 2048) {
+		return eConvolutionKernel::REDUCE_VEC;
+	}
+	return eConvolutionKernel::REDUCE_TILED;
+}
+
+// Runs any of the kernels with the same contract: outputs [n, n + lenOut) of the full convolution are
+// written to the output range, or added to it if accumulate is set. The tiled kernel takes its tile sizes
+// from cacheSizes, the caller looks them up once rather than for every call.
+template <class Iter1, class Iter2, class IterOut>
+void ConvolutionDispatch(eConvolutionKernel kernel, Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, IterOut firstOut, IterOut lastOut, ptrdiff_t n, bool accumulate = false, const CacheSizes& cacheSizes = {}) {
+	switch (kernel) {
+		case eConvolutionKernel::NAIVE: ConvolutionNaive(first1, last1, first2, last2, firstOut, lastOut, n, accumulate); break;
+		case eConvolutionKernel::SLIDE: ConvolutionSlide(first1, last1, first2, last2, firstOut, lastOut, n, accumulate); break;
+		case eConvolutionKernel::REDUCE: ConvolutionReduce(first1, last1, first2, last2, firstOut, lastOut, n, accumulate); break;
+		case eConvolutionKernel::REDUCE_VEC: ConvolutionReduceVec(first1, last1, first2, last2, firstOut, lastOut, n, accumulate, plus_compensated<>{}); break;
+		case eConvolutionKernel::REDUCE_BLOCKED: ConvolutionReduceBlocked(first1, last1, first2, last2, firstOut, lastOut, n, accumulate, plus_compensated<>{}); break;
+		case eConvolutionKernel::REDUCE_TILED: {
+			using T1 = typename std::iterator_traits<Iter1>::value_type;
+			using OutT = typename std::iterator_traits<IterOut>::value_type;
+			const auto [outputTile, filterTile] = ConvolutionTileSizes<T1, OutT>(cacheSizes);
+			ConvolutionReduceTiled(first1, last1, first2, last2, firstOut, lastOut, n, outputTile, filterTile, accumulate, plus_compensated<>{});
+			break;
+		}
+	}
+}
+
+// Runs the kernel that SelectConvolutionKernel picks for the inputs.
+template <class Iter1, class Iter2, class IterOut>
+void ConvolutionAuto(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, IterOut firstOut, IterOut lastOut, ptrdiff_t n, bool accumulate = false, const CacheSizes& cacheSizes = {}) {
+	const auto kernel = SelectConvolutionKernel(std::distance(first1, last1), std::distance(first2, last2));
+	ConvolutionDispatch(kernel, first1, last1, first2, last2, firstOut, lastOut, n, accumulate, cacheSizes);
+}
+
+
+template <bool Antisymmetric, class U>
+auto MirrorPreAdd(const U& sample, const U& mirrored) {
+	if constexpr (Antisymmetric) {
+		return sample - mirrored;
+	}
+	else {
+		return sample + mirrored;
+	}
+}
+
+template <ptrdiff_t BlockSize, bool Antisymmetric, class IterHalf, class IterSignal, class IterOut, class ReduceOp>
+void ConvolutionSymmetricImpl(IterHalf firstHalf, ptrdiff_t filterSize, IterSignal firstSignal, IterSignal lastSignal, IterOut firstOut, IterOut lastOut, ptrdiff_t n, bool accumulate, ReduceOp reduceOp) {
+	using T1 = typename std::iterator_traits<IterHalf>::value_type;
+	using T2 = typename std::iterator_traits<IterSignal>::value_type;
+	using OutT = typename std::iterator_traits<IterOut>::value_type;
+
+	constexpr bool isVectorized = is_convolution_reduce_vectorized<T1, T2, OutT>::value;
+	constexpr ptrdiff_t vectorWidth = isVectorized ? xsimd::simd_traits<OutT>::size : 1;
+	constexpr ptrdiff_t blockWidth = BlockSize * vectorWidth;
+	using OutV = std::conditional_t<isVectorized, xsimd::simd_type<OutT>, OutT>;
+	using V1 = std::conditional_t<isVectorized, xsimd::simd_type<T1>, T1>;
+	using V2 = std::conditional_t<isVectorized, xsimd::simd_type<T2>, T2>;
+
+	const ptrdiff_t numPairs = filterSize / 2;
+	const bool hasCenter = filterSize % 2 == 1;
+	const ptrdiff_t lenSignal = std::distance(firstSignal, lastSignal);
+	const ptrdiff_t lenOut = std::distance(firstOut, lastOut);
+
+	// Outputs in [interiorFirst, interiorLast) take all taps, and none of them index outside the signal.
+	const ptrdiff_t interiorFirst = std::clamp(filterSize - 1 - n, ptrdiff_t(0), lenOut);
+	const ptrdiff_t interiorLast = std::max(interiorFirst, std::min(lenOut, lenSignal - n));
+	const ptrdiff_t blockedLast = interiorFirst + (interiorLast - interiorFirst) / blockWidth * blockWidth;
+
+	const auto edge = [&](ptrdiff_t outFirst, ptrdiff_t outLast) {
+		const auto sample = [&](ptrdiff_t index) {
+			return 0 <= index && index < lenSignal ? T2(firstSignal[index]) : T2(0);
+		};
+		for (ptrdiff_t outIdx = outFirst; outIdx < outLast; ++outIdx) {
+			const ptrdiff_t position = n + outIdx;
+			OutT accumulator = accumulate ? OutT(firstOut[outIdx]) : OutT(0);
+			for (ptrdiff_t k = 0; k < numPairs; ++k) {
+				accumulator += firstHalf[k] * MirrorPreAdd<Antisymmetric>(sample(position - k), sample(position - filterSize + 1 + k));
+			}
+			if (hasCenter) {
+				accumulator += firstHalf[numPairs] * sample(position - numPairs);
+			}
+			firstOut[outIdx] = accumulator;
+		}
+	};
+	edge(0, interiorFirst);
+	edge(blockedLast, lenOut);
+
+	for (ptrdiff_t outIdx = interiorFirst; outIdx < blockedLast; outIdx += blockWidth) {
+		std::array<OutV, BlockSize> accumulators;
+		for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+			accumulators[b] = accumulate ? uniform_load_unaligned<OutV>(std::addressof(*(firstOut + outIdx + b * vectorWidth))) : OutV(OutT(0));
+		}
+		[[maybe_unused]] std::array<decltype(make_compensation_carry<OutV, multiplies_result_t<V1, V2>>(reduceOp, accumulators[0])), BlockSize> carries;
+		if constexpr (is_operator_compensated_v<ReduceOp>) {
+			for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+				carries[b] = make_compensation_carry<OutV, multiplies_result_t<V1, V2>>(reduceOp, accumulators[b]);
+			}
+		}
+
+		// Tap k pairs the sample k before the output with the sample filterSize - 1 - k before it.
+		// Both are read forward along the block, so the mirrored half needs no reversed loads.
+		const auto near = firstSignal + (n + outIdx);
+		const auto far = firstSignal + (n + outIdx - filterSize + 1);
+		const auto pair = [&](ptrdiff_t lane, ptrdiff_t k) {
+			return MirrorPreAdd<Antisymmetric>(uniform_load_unaligned<V2>(std::addressof(*(near + (lane - k)))),
+											   uniform_load_unaligned<V2>(std::addressof(*(far + (lane + k)))));
+		};
+		ptrdiff_t k = 0;
+		for (; k + 4 <= numPairs; k += 4) {
+			const V1 c0(firstHalf[k]);
+			const V1 c1(firstHalf[k + 1]);
+			const V1 c2(firstHalf[k + 2]);
+			const V1 c3(firstHalf[k + 3]);
+			for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+				const ptrdiff_t lane = b * vectorWidth;
+				const auto v0 = c0 * pair(lane, k);
+				const auto v1 = c1 * pair(lane, k + 1);
+				const auto v2 = c2 * pair(lane, k + 2);
+				const auto v3 = c3 * pair(lane, k + 3);
+				if constexpr (is_operator_compensated_v<ReduceOp>) {
+					accumulators[b] = reduceOp(carries[b], accumulators[b], (v0 + v1) + (v2 + v3));
+				}
+				else {
+					accumulators[b] = reduceOp(accumulators[b], (v0 + v1) + (v2 + v3));
+				}
+			}
+		}
+		for (; k < numPairs; ++k) {
+			const V1 c(firstHalf[k]);
+			for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+				accumulators[b] += c * pair(b * vectorWidth, k);
+			}
+		}
+		if (hasCenter) {
+			const V1 c(firstHalf[numPairs]);
+			for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+				accumulators[b] += c * uniform_load_unaligned<V2>(std::addressof(*(near + (b * vectorWidth - numPairs))));
+			}
+		}
+
+		for (ptrdiff_t b = 0; b < BlockSize; ++b) {
+			uniform_store_unaligned(std::addressof(*(firstOut + outIdx + b * vectorWidth)), accumulators[b]);
+		}
+	}
+}
+
+// Convolves the signal with a linear-phase filter of filterSize taps, given by its first (filterSize + 1) / 2 taps.
+// The remaining taps mirror the first ones, negated if the filter is antisymmetric. Input samples that share a
+// tap are added before the multiplication, so it takes half the multiplies of a general convolution.
+template <ptrdiff_t BlockSize = 4, class IterHalf, class IterSignal, class IterOut, class ReduceOp = plus_compensated<>>
+void ConvolutionSymmetric(IterHalf firstHalf, [[maybe_unused]] IterHalf lastHalf, ptrdiff_t filterSize, bool antisymmetric, IterSignal firstSignal, IterSignal lastSignal, IterOut firstOut, IterOut lastOut, ptrdiff_t n, bool accumulate = false, ReduceOp reduceOp = plus_compensated<>{}) {
+	assert(std::distance(firstHalf, lastHalf) == (filterSize + 1) / 2);
+	if (antisymmetric) {
+		ConvolutionSymmetricImpl<BlockSize, true>(firstHalf, filterSize, firstSignal, lastSignal, firstOut, lastOut, n, accumulate, reduceOp);
+	}
+	else {
+		ConvolutionSymmetricImpl<BlockSize, false>(firstHalf, filterSize, firstSignal, lastSignal, firstOut, lastOut, n, accumulate, reduceOp);
+	}
+}
+
 } // namespace dspbb::kernels
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "../Math/DotProduct.hpp"
 #include "../Primitives/Signal.hpp"
 #include "../Primitives/SignalView.hpp"
+#include "../Utility/CacheSizes.hpp"
+#include "../Utility/Threading.hpp"
 #include "../Utility/TypeTraits.hpp"
 
 #include <complex>
@@ -21,6 +23,27 @@ namespace impl {
 using impl::CONV_CENTRAL;
 using impl::CONV_FULL;
 
+namespace impl {
+	// The tiles are the same regardless of the number of workers, so the result does not depend on it either.
+	// A tile of outputs and the input samples they read should stay in L2 between the passes of the kernels.
+	template <class SignalR, class SignalT, class SignalU>
+	void ConvolutionTiled(SignalR& out, const SignalT& u, const SignalU& v, size_t offset, size_t numThreads, bool clearOut) {
+		using R = typename signal_traits<std::decay_t<SignalR>>::type;
+		const CacheSizes cacheSizes = GetCacheSizes();
+		const size_t tileSize = std::max(size_t(64), cacheSizes.l2 / (8 * sizeof(R)));
+		const size_t numTiles = (out.size() + tileSize - 1) / tileSize;
+		const auto kernel = kernels::SelectConvolutionKernel(u.size(), v.size());
+		const size_t numWorkers = BatchWorkerCount(numTiles, numThreads);
+		ParallelRanges(numTiles, numWorkers, [&](size_t first, size_t last, size_t) {
+			for (; first < last; ++first) {
+				const size_t tileFirst = first * tileSize;
+				const size_t tileLast = std::min(out.size(), tileFirst + tileSize);
+				kernels::ConvolutionDispatch(kernel, u.begin(), u.end(), v.begin(), v.end(), out.begin() + tileFirst, out.begin() + tileLast, ptrdiff_t(offset + tileFirst), !clearOut, cacheSizes);
+			}
+		});
+	}
+} // namespace impl
+
 /// <summary> Calculates the length of the result of the convolution U*V. </summary>
 /// <param name="lengthU"> size of U. </param>
 /// <param name="lengthV"> size of V. </param>
@@ -52,14 +75,17 @@ auto Convolution(SignalR&& out, const SignalT& u, const SignalU& v, size_t offse
 	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
 	assert(offset + out.size() <= fullLength && "Result is outside of full convolution, thus contains some true zeros. I mean, it's ok, but you are probably doing it wrong.");
 
-	// Slided is faster, but it's accuracy degrades for large input and a compensated reduction is better.
-	const size_t shorterSize = std::min(u.size(), v.size());
-	if (shorterSize <= 32) {
-		kernels::ConvolutionSlide(u.begin(), u.end(), v.begin(), v.end(), out.begin(), out.end(), offset, !clearOut);
-	}
-	else {
-		kernels::ConvolutionReduceVec(u.begin(), u.end(), v.begin(), v.end(), out.begin(), out.end(), offset, !clearOut, plus_compensated<>{});
-	}
+	impl::ConvolutionTiled(out, u, v, offset, 1, clearOut);
+}
+
+/// <summary> Computes the same outputs as the serial convolution, with the output split between multiple threads. </summary>
+/// <remarks> The output is processed in cache-sized tiles and the tiles are spread over the threads.
+///		The serial convolution uses the same tiles, so the results are bitwise identical. </remarks>
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+auto Convolution(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset, ParallelExecution execution, bool clearOut = true) {
+	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	assert(offset + out.size() <= fullLength && "Result is outside of full convolution, thus contains some true zeros. I mean, it's ok, but you are probably doing it wrong.");
+	impl::ConvolutionTiled(out, u, v, offset, execution.numThreads, clearOut);
 }
 
 template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
@@ -78,6 +104,22 @@ auto Convolution(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvCe
 	Convolution(out, u, v, offset, clearOut);
 }
 
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+auto Convolution(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvFull, ParallelExecution execution, bool clearOut = true) {
+	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	assert(out.size() == fullLength && "Use ConvolutionLength to calculate output size properly.");
+	const size_t offset = 0;
+	Convolution(out, u, v, offset, execution, clearOut);
+}
+
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+auto Convolution(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvCentral, ParallelExecution execution, bool clearOut = true) {
+	const size_t centralLength = ConvolutionLength(u.size(), v.size(), CONV_CENTRAL);
+	assert(out.size() == centralLength && "Use ConvolutionLength to calculate output size properly.");
+	const size_t offset = std::min(u.size() - 1, v.size() - 1);
+	Convolution(out, u, v, offset, execution, clearOut);
+}
+
 template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
 auto Convolution(const SignalT& u, const SignalU& v, size_t offset, size_t length) {
 	constexpr eSignalDomain Domain = signal_traits<std::decay_t<SignalT>>::domain;
@@ -85,8 +127,8 @@ auto Convolution(const SignalT& u, const SignalU& v, size_t offset, size_t lengt
 	using U = typename signal_traits<std::decay_t<SignalU>>::type;
 	using R = multiplies_result_t<T, U>;
 
-	BasicSignal<R, Domain> out(length, R(0));
-	Convolution(out, u, v, offset, false);
+	BasicSignal<R, Domain> out(length);
+	Convolution(out, u, v, offset);
 	return out;
 }
 
@@ -104,4 +146,20 @@ auto Convolution(const SignalT& u, const SignalU& v, impl::ConvCentral) {
 	return Convolution(u, v, offset, length);
 }
 
+template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
+auto Convolution(const SignalT& u, const SignalU& v, impl::ConvFull, ParallelExecution execution) {
+	using R = multiplies_result_t<typename signal_traits<std::decay_t<SignalT>>::type, typename signal_traits<std::decay_t<SignalU>>::type>;
+	BasicSignal<R, signal_traits<std::decay_t<SignalT>>::domain> out(ConvolutionLength(u.size(), v.size(), CONV_FULL));
+	Convolution(out, u, v, CONV_FULL, execution);
+	return out;
+}
+
+template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
+auto Convolution(const SignalT& u, const SignalU& v, impl::ConvCentral, ParallelExecution execution) {
+	using R = multiplies_result_t<typename signal_traits<std::decay_t<SignalT>>::type, typename signal_traits<std::decay_t<SignalU>>::type>;
+	BasicSignal<R, signal_traits<std::decay_t<SignalT>>::domain> out(ConvolutionLength(u.size(), v.size(), CONV_CENTRAL));
+	Convolution(out, u, v, CONV_CENTRAL, execution);
+	return out;
+}
+
 } // namespace dspbb
@@ -4,8 +4,12 @@
 #include "../PocketFFT/pocketfft_hdronly.h"
 #include "../Primitives/Signal.hpp"
 #include "../Primitives/SignalView.hpp"
+#include "../Utility/Threading.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 
 namespace dspbb {
@@ -20,6 +24,17 @@ namespace impl {
 	constexpr FftFull FFT_FULL;
 	constexpr FftHalf FFT_HALF;
 
+	// Fills the upper half of a real signal's spectrum from the conjugate of the lower half.
+	// Mirroring and conjugation are done in the same pass to touch the upper half only once.
+	template <class T>
+	void FftMirrorHalf(SpectrumView<std::complex<T>> out) {
+		const size_t fullSize = out.size();
+		const size_t lowerLast = (fullSize + 1) / 2;
+		for (size_t k = 1; k < lowerLast; ++k) {
+			out[fullSize - k] = std::conj(out[k]);
+		}
+	}
+
 	template <class T>
 	void Fft(SpectrumView<std::complex<T>> out, SignalView<const T> in) {
 		const size_t halfSize = in.size() / 2 + 1;
@@ -31,13 +46,8 @@ namespace impl {
 		pocketfft_dspbb::stride_t stride_out = { sizeof(std::complex<T>) };
 		pocketfft_dspbb::r2c(shape, stride_in, stride_out, 0, pocketfft_dspbb::FORWARD, in.data(), out.data(), T(1));
 
-		if (out.size() == fullSize && fullSize > 2) {
-			auto first = out.begin() + 1;
-			auto last = out.begin() + (fullSize + 1) / 2;
-			auto dest = out.begin() + fullSize / 2 + 1;
-			std::reverse_copy(first, last, dest);
-			const auto mirrorRange = AsView<FREQUENCY_DOMAIN>(dest, out.end());
-			Conj(mirrorRange, mirrorRange);
+		if (out.size() == fullSize) {
+			FftMirrorHalf(out);
 		}
 	}
 
@@ -127,6 +137,428 @@ namespace impl {
 } // namespace impl
 
 
+//------------------------------------------------------------------------------
+// Plans
+//------------------------------------------------------------------------------
+
+/// <summary> A precomputed FFT of a fixed size that owns its work area. </summary>
+/// <remarks> Executing the plan does not allocate memory, but it does use the work area,
+///		so a single plan must not be executed on multiple threads simultaneously. </remarks>
+/// <typeparam name="T"> The type of the time domain samples. Real types yield R2C and C2R
+///		transforms, complex types yield C2C transforms. </typeparam>
+template <class T>
+class FftPlan {
+	using real_type = remove_complex_t<T>;
+	using complex_type = std::complex<real_type>;
+	using plan_type = std::conditional_t<is_complex_v<T>, pocketfft_dspbb::pocketfft_c<real_type>, pocketfft_dspbb::pocketfft_r<real_type>>;
+	using native_type = std::conditional_t<is_complex_v<T>, pocketfft_dspbb::cmplx<real_type>, real_type>;
+
+public:
+	FftPlan() = default;
+	explicit FftPlan(size_t size);
+
+	size_t size() const;
+
+	/// <summary> Forward transform. The output may be the half or the full spectrum for real plans. </summary>
+	void execute(SpectrumView<complex_type> out, SignalView<const T> in);
+	/// <summary> Inverse transform. Only the first half of the input is used for real plans. </summary>
+	void execute(SignalView<T> out, SpectrumView<const complex_type> in);
+
+private:
+	native_type* scratch();
+
+private:
+	std::shared_ptr<const plan_type> m_plan;
+	BasicSignal<T, DOMAINLESS> m_scratch;
+};
+
+template <class T>
+FftPlan<T>::FftPlan(size_t size) {
+	auto plan = std::make_shared<const plan_type>(size);
+	// The scratch size of the real plan is counted in reals, that of the complex plan in complexes.
+	m_scratch.resize(plan->scratch_size(), T(0));
+	m_plan = std::move(plan);
+}
+
+template <class T>
+size_t FftPlan<T>::size() const {
+	return m_plan ? m_plan->length() : 0;
+}
+
+template <class T>
+auto FftPlan<T>::scratch() -> native_type* {
+	return reinterpret_cast<native_type*>(m_scratch.data());
+}
+
+template <class T>
+void FftPlan<T>::execute(SpectrumView<complex_type> out, SignalView<const T> in) {
+	assert(m_plan);
+	assert(in.size() == size());
+
+	if constexpr (is_complex_v<T>) {
+		assert(out.size() == size());
+		if (static_cast<const void*>(out.data()) != static_cast<const void*>(in.data())) {
+			std::copy(in.begin(), in.end(), out.begin());
+		}
+		m_plan->exec(reinterpret_cast<native_type*>(out.data()), scratch(), real_type(1), true);
+	}
+	else {
+		assert(out.size() == size() / 2 + 1 || out.size() == size());
+		// FFTPACK's halfcomplex order is [r0, r1, i1, r2, i2, ...], which matches the
+		// interleaved complex output except for r0, when written one real to the right.
+		real_type* packed = reinterpret_cast<real_type*>(out.data());
+		std::copy(in.begin(), in.end(), packed + 1);
+		m_plan->exec(packed + 1, scratch(), real_type(1), true);
+		packed[0] = packed[1];
+		packed[1] = real_type(0);
+		if (size() % 2 == 0) {
+			packed[size() + 1] = real_type(0);
+		}
+		if (out.size() == size()) {
+			impl::FftMirrorHalf(out);
+		}
+	}
+}
+
+template <class T>
+void FftPlan<T>::execute(SignalView<T> out, SpectrumView<const complex_type> in) {
+	assert(m_plan);
+	assert(out.size() == size());
+	const real_type scale = real_type(1.0 / double(size()));
+
+	if constexpr (is_complex_v<T>) {
+		assert(in.size() == size());
+		if (static_cast<const void*>(out.data()) != static_cast<const void*>(in.data())) {
+			std::copy(in.begin(), in.end(), out.begin());
+		}
+		m_plan->exec(reinterpret_cast<native_type*>(out.data()), scratch(), scale, false);
+	}
+	else {
+		assert(in.size() == size() / 2 + 1 || in.size() == size());
+		// Reverse of the forward transform: drop the zero imaginary parts of DC and Nyquist.
+		const real_type* packed = reinterpret_cast<const real_type*>(in.data());
+		out[0] = packed[0];
+		std::copy(packed + 2, packed + size() + 1, out.begin() + 1);
+		m_plan->exec(out.data(), scratch(), scale, false);
+	}
+}
+
+
+namespace impl {
+	// The SIMD vector that pocketfft uses to transform several signals at once, one per lane.
+	template <class R, bool Vectorized = (pocketfft_dspbb::detail::VLEN<R>::val > 1)>
+	struct FftLanes {
+		using type = R;
+		static constexpr size_t count = 1;
+		static R Get(const type& value, size_t) { return value; }
+		static void Set(type& value, size_t, R element) { value = element; }
+	};
+
+#ifndef POCKETFFT_NO_VECTORS
+	template <class R>
+	struct FftLanes<R, true> {
+		using type = pocketfft_dspbb::detail::vtype_t<R>;
+		static constexpr size_t count = pocketfft_dspbb::detail::VLEN<R>::val;
+		static R Get(const type& value, size_t lane) { return value[lane]; }
+		static void Set(type& value, size_t lane, R element) { value[lane] = element; }
+	};
+#endif
+} // namespace impl
+
+
+/// <summary> A precomputed FFT of a fixed size that transforms several signals at once. </summary>
+/// <remarks> The signals are transposed into SIMD vectors so that each vector lane carries a different signal,
+///		which makes one pass of the FFT do the work of lanes() transforms. Like FftPlan, it owns its work area,
+///		so executing it does not allocate memory, and a single plan must not be executed on multiple threads simultaneously. </remarks>
+/// <typeparam name="T"> The type of the time domain samples. Real types yield R2C, complex types yield C2C transforms. </typeparam>
+template <class T>
+class FftBatchPlan {
+	using real_type = remove_complex_t<T>;
+	using complex_type = std::complex<real_type>;
+	using lanes_type = impl::FftLanes<real_type>;
+	using lane_type = typename lanes_type::type;
+	using plan_type = std::conditional_t<is_complex_v<T>, pocketfft_dspbb::pocketfft_c<real_type>, pocketfft_dspbb::pocketfft_r<real_type>>;
+	using native_type = std::conditional_t<is_complex_v<T>, pocketfft_dspbb::cmplx<lane_type>, lane_type>;
+
+public:
+	FftBatchPlan() = default;
+	explicit FftBatchPlan(size_t size);
+
+	size_t size() const;
+	/// <summary> The number of signals transformed together in one pass. </summary>
+	static constexpr size_t lanes() { return lanes_type::count; }
+
+	/// <summary> Forward transforms multiple channels of equal length stored one after another. </summary>
+	/// <param name="out"> The spectra one after another, either all half or all full spectra for real plans. </param>
+	void execute(SpectrumView<complex_type> out, SignalView<const T> in, size_t numChannels);
+
+private:
+	void Load(native_type* data, SignalView<const T> in, size_t numChannels) const;
+	void Store(SpectrumView<complex_type> out, const native_type* data, size_t numChannels) const;
+	static native_type* Aligned(std::vector<unsigned char>& storage);
+
+private:
+	std::shared_ptr<const plan_type> m_plan;
+	std::vector<unsigned char> m_data;
+	std::vector<unsigned char> m_scratch;
+};
+
+template <class T>
+FftBatchPlan<T>::FftBatchPlan(size_t size) {
+	auto plan = std::make_shared<const plan_type>(size);
+	// Over-allocated so that the vectors can be aligned within the buffers.
+	m_data.resize((size + 1) * sizeof(native_type), 0);
+	m_scratch.resize((plan->scratch_size() + 1) * sizeof(native_type), 0);
+	m_plan = std::move(plan);
+}
+
+template <class T>
+size_t FftBatchPlan<T>::size() const {
+	return m_plan ? m_plan->length() : 0;
+}
+
+template <class T>
+auto FftBatchPlan<T>::Aligned(std::vector<unsigned char>& storage) -> native_type* {
+	const auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+	const auto alignment = std::uintptr_t(alignof(native_type));
+	return reinterpret_cast<native_type*>((address + alignment - 1) / alignment * alignment);
+}
+
+template <class T>
+void FftBatchPlan<T>::execute(SpectrumView<complex_type> out, SignalView<const T> in, size_t numChannels) {
+	assert(m_plan);
+	assert(in.size() == numChannels * size());
+	if (numChannels == 0) {
+		return;
+	}
+	const size_t spectrumSize = out.size() / numChannels;
+	assert(out.size() == numChannels * spectrumSize);
+	assert(spectrumSize == size() || (!is_complex_v<T> && spectrumSize == size() / 2 + 1));
+
+	native_type* data = Aligned(m_data);
+	native_type* scratch = Aligned(m_scratch);
+	for (size_t first = 0; first < numChannels; first += lanes()) {
+		const size_t count = std::min(lanes(), numChannels - first);
+		Load(data, in.subsignal(first * size(), count * size()), count);
+		m_plan->exec(data, scratch, real_type(1), true);
+		Store(out.subsignal(first * spectrumSize, count * spectrumSize), data, count);
+	}
+}
+
+template <class T>
+void FftBatchPlan<T>::Load(native_type* data, SignalView<const T> in, size_t numChannels) const {
+	const size_t n = size();
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t lane = 0; lane < lanes(); ++lane) {
+			const T sample = lane < numChannels ? in[lane * n + i] : T(0);
+			if constexpr (is_complex_v<T>) {
+				lanes_type::Set(data[i].r, lane, sample.real());
+				lanes_type::Set(data[i].i, lane, sample.imag());
+			}
+			else {
+				lanes_type::Set(data[i], lane, sample);
+			}
+		}
+	}
+}
+
+template <class T>
+void FftBatchPlan<T>::Store(SpectrumView<complex_type> out, const native_type* data, size_t numChannels) const {
+	const size_t n = size();
+	const size_t spectrumSize = out.size() / numChannels;
+	for (size_t lane = 0; lane < numChannels; ++lane) {
+		auto spectrum = out.subsignal(lane * spectrumSize, spectrumSize);
+		if constexpr (is_complex_v<T>) {
+			for (size_t k = 0; k < n; ++k) {
+				spectrum[k] = { lanes_type::Get(data[k].r, lane), lanes_type::Get(data[k].i, lane) };
+			}
+		}
+		else {
+			// FFTPACK's halfcomplex order: [r0, r1, i1, r2, i2, ..., r(n/2) for even n].
+			spectrum[0] = { lanes_type::Get(data[0], lane), real_type(0) };
+			for (size_t k = 1; 2 * k < n; ++k) {
+				spectrum[k] = { lanes_type::Get(data[2 * k - 1], lane), lanes_type::Get(data[2 * k], lane) };
+			}
+			if (n % 2 == 0) {
+				spectrum[n / 2] = { lanes_type::Get(data[n - 1], lane), real_type(0) };
+			}
+			if (spectrumSize == n) {
+				impl::FftMirrorHalf(spectrum);
+			}
+		}
+	}
+}
+
+
+//------------------------------------------------------------------------------
+// Hermitian spectra
+//------------------------------------------------------------------------------
+
+/// <summary> Read-only view of the full spectrum of a real signal that is backed by the non-redundant half. </summary>
+/// <remarks> Bins above the Nyquist frequency are synthesized on access as the conjugates of the lower bins,
+///		so the full spectrum never has to be materialized. </remarks>
+template <class T>
+class HermitianSpectrumView {
+public:
+	using value_type = std::complex<T>;
+	using size_type = std::size_t;
+
+public:
+	HermitianSpectrumView() = default;
+	HermitianSpectrumView(SpectrumView<const std::complex<T>> half, size_type fullSize);
+
+	value_type operator[](size_type index) const;
+	size_type size() const;
+	bool empty() const;
+	SpectrumView<const std::complex<T>> half() const;
+
+private:
+	SpectrumView<const std::complex<T>> m_half;
+	size_type m_fullSize = 0;
+};
+
+template <class T>
+HermitianSpectrumView<T>::HermitianSpectrumView(SpectrumView<const std::complex<T>> half, size_type fullSize)
+	: m_half(half), m_fullSize(fullSize) {
+	assert(half.size() == fullSize / 2 + 1);
+}
+
+template <class T>
+auto HermitianSpectrumView<T>::operator[](size_type index) const -> value_type {
+	assert(index < m_fullSize);
+	return index < m_half.size() ? m_half[index] : std::conj(m_half[m_fullSize - index]);
+}
+
+template <class T>
+auto HermitianSpectrumView<T>::size() const -> size_type {
+	return m_fullSize;
+}
+
+template <class T>
+bool HermitianSpectrumView<T>::empty() const {
+	return m_fullSize == 0;
+}
+
+template <class T>
+SpectrumView<const std::complex<T>> HermitianSpectrumView<T>::half() const {
+	return m_half;
+}
+
+/// <summary> Views the half spectrum returned by Fft(..., FFT_HALF) as the full spectrum. </summary>
+/// <param name="fullSize"> The length of the original real signal. </param>
+template <class SignalT>
+auto AsHermitianView(const SignalT& half, size_t fullSize) {
+	using T = remove_complex_t<std::remove_const_t<typename signal_traits<std::decay_t<SignalT>>::type>>;
+	return HermitianSpectrumView<T>{ AsConstView(half), fullSize };
+}
+
+/// <summary> Multiplies a full spectrum by a Hermitian one element-wise without expanding the Hermitian spectrum. </summary>
+template <class SignalR, class SignalT, class T, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT>, int> = 0>
+void MultiplyHermitian(SignalR&& out, const SignalT& a, const HermitianSpectrumView<T>& b) {
+	assert(out.size() == a.size());
+	assert(a.size() == b.size());
+	const auto half = b.half();
+	const size_t fullSize = b.size();
+	kernels::Transform(a.begin(), a.begin() + half.size(), half.begin(), out.begin(), std::multiplies{});
+	for (size_t k = half.size(); k < fullSize; ++k) {
+		out[k] = a[k] * std::conj(half[fullSize - k]);
+	}
+}
+
+
+//------------------------------------------------------------------------------
+// Batched kernels
+//------------------------------------------------------------------------------
+
+namespace impl {
+	// Planar layout: the channels are stored one after another, each taking up size/numChannels samples.
+	template <class T>
+	void FftBatch(SpectrumView<std::complex<T>> out, SignalView<const T> in, size_t numChannels, size_t numThreads) {
+		if (numChannels == 0) {
+			return;
+		}
+		const size_t length = in.size() / numChannels;
+		const size_t outLength = out.size() / numChannels;
+		assert(in.size() == length * numChannels);
+		assert(out.size() == outLength * numChannels);
+		assert(outLength == length / 2 + 1 || outLength == length);
+
+		pocketfft_dspbb::shape_t shape = { numChannels, length };
+		pocketfft_dspbb::stride_t stride_in = { ptrdiff_t(length * sizeof(T)), sizeof(T) };
+		pocketfft_dspbb::stride_t stride_out = { ptrdiff_t(outLength * sizeof(std::complex<T>)), sizeof(std::complex<T>) };
+		pocketfft_dspbb::r2c(shape, stride_in, stride_out, 1, pocketfft_dspbb::FORWARD, in.data(), out.data(), T(1), numThreads);
+
+		if (outLength == length) {
+			for (size_t channel = 0; channel < numChannels; ++channel) {
+				FftMirrorHalf(out.subsignal(channel * outLength, outLength));
+			}
+		}
+	}
+
+	template <class T>
+	void FftBatch(SpectrumView<std::complex<T>> out, SignalView<const std::complex<T>> in, size_t numChannels, size_t numThreads) {
+		if (numChannels == 0) {
+			return;
+		}
+		const size_t length = in.size() / numChannels;
+		assert(in.size() == length * numChannels);
+		assert(out.size() == in.size());
+
+		pocketfft_dspbb::shape_t shape = { numChannels, length };
+		pocketfft_dspbb::stride_t stride = { ptrdiff_t(length * sizeof(std::complex<T>)), sizeof(std::complex<T>) };
+		pocketfft_dspbb::shape_t axes = { 1 };
+		pocketfft_dspbb::c2c(shape, stride, stride, axes, pocketfft_dspbb::FORWARD, in.data(), out.data(), T(1), numThreads);
+	}
+
+	template <class T>
+	void IfftBatch(SignalView<T> out, SpectrumView<const std::complex<T>> in, size_t numChannels, size_t numThreads) {
+		if (numChannels == 0) {
+			return;
+		}
+		const size_t length = out.size() / numChannels;
+		const size_t inLength = in.size() / numChannels;
+		assert(out.size() == length * numChannels);
+		assert(in.size() == inLength * numChannels);
+		assert(inLength == length / 2 + 1 || inLength == length);
+
+		pocketfft_dspbb::shape_t shape = { numChannels, length };
+		pocketfft_dspbb::stride_t stride_in = { ptrdiff_t(inLength * sizeof(std::complex<T>)), sizeof(std::complex<T>) };
+		pocketfft_dspbb::stride_t stride_out = { ptrdiff_t(length * sizeof(T)), sizeof(T) };
+		pocketfft_dspbb::c2r<T>(shape, stride_in, stride_out, 1, pocketfft_dspbb::BACKWARD, in.data(), out.data(), T(1.0 / double(length)), numThreads);
+	}
+
+	template <class T>
+	void IfftBatch(SignalView<std::complex<T>> out, SpectrumView<const std::complex<T>> in, size_t numChannels, size_t numThreads) {
+		if (numChannels == 0) {
+			return;
+		}
+		const size_t length = out.size() / numChannels;
+		assert(out.size() == length * numChannels);
+		assert(out.size() == in.size());
+
+		pocketfft_dspbb::shape_t shape = { numChannels, length };
+		pocketfft_dspbb::stride_t stride = { ptrdiff_t(length * sizeof(std::complex<T>)), sizeof(std::complex<T>) };
+		pocketfft_dspbb::shape_t axes = { 1 };
+		pocketfft_dspbb::c2c(shape, stride, stride, axes, pocketfft_dspbb::BACKWARD, in.data(), out.data(), T(1.0 / double(length)), numThreads);
+	}
+
+	// Runs op(out[i], in[i], plan) for every channel on the thread pool of ParallelRanges. The workers share the
+	// precomputed plan, but each needs its own work area, which is allocated once per worker rather than per transform.
+	template <class ContainerR, class ContainerT, class T, class Op>
+	void ExecuteBatch(ContainerR& out, const ContainerT& in, FftPlan<T>& plan, size_t numThreads, Op op) {
+		assert(out.size() == in.size());
+		const size_t numWorkers = BatchWorkerCount(in.size(), numThreads);
+		std::vector<FftPlan<T>> workerPlans(numWorkers - 1, plan);
+		ParallelRanges(in.size(), numWorkers, [&](size_t first, size_t last, size_t worker) {
+			FftPlan<T>& workerPlan = worker == 0 ? plan : workerPlans[worker - 1];
+			for (; first < last; ++first) {
+				op(out[first], in[first], workerPlan);
+			}
+		});
+	}
+} // namespace impl
+
+
 //------------------------------------------------------------------------------
 // Wrappers
 //------------------------------------------------------------------------------
@@ -144,6 +576,54 @@ auto Ifft(SignalR&& out, const SignalT& in) -> decltype(impl::Ifft(AsView(out),
 	return impl::Ifft(AsView(out), AsView(in));
 }
 
+template <class SignalR, class SignalT, class T, std::enable_if_t<signal_traits<std::decay_t<SignalR>>::domain == FREQUENCY_DOMAIN, int> = 0>
+auto Fft(SignalR&& out, const SignalT& in, FftPlan<T>& plan) -> decltype(plan.execute(AsView(out), AsView(in))) {
+	return plan.execute(AsView(out), AsView(in));
+}
+
+template <class SignalR, class SignalT, class T, std::enable_if_t<signal_traits<std::decay_t<SignalR>>::domain == TIME_DOMAIN, int> = 0>
+auto Ifft(SignalR&& out, const SignalT& in, FftPlan<T>& plan) -> decltype(plan.execute(AsView(out), AsView(in))) {
+	return plan.execute(AsView(out), AsView(in));
+}
+
+
+/// <summary> Transforms multiple channels of equal length stored one after another in a single buffer. </summary>
+/// <param name="numThreads"> The number of threads to use, 0 means all hardware threads. </param>
+template <class SignalR, class SignalT>
+auto FftBatch(SignalR&& out, const SignalT& in, size_t numChannels, size_t numThreads = 0)
+	-> decltype(impl::FftBatch(AsView(out), AsView(in), numChannels, numThreads)) {
+	return impl::FftBatch(AsView(out), AsView(in), numChannels, numThreads);
+}
+
+/// <summary> Inverse transforms multiple channels of equal length stored one after another in a single buffer. </summary>
+/// <param name="numThreads"> The number of threads to use, 0 means all hardware threads. </param>
+template <class SignalR, class SignalT>
+auto IfftBatch(SignalR&& out, const SignalT& in, size_t numChannels, size_t numThreads = 0)
+	-> decltype(impl::IfftBatch(AsView(out), AsView(in), numChannels, numThreads)) {
+	return impl::IfftBatch(AsView(out), AsView(in), numChannels, numThreads);
+}
+
+/// <summary> Transforms multiple channels of equal length stored one after another, several channels per pass. </summary>
+template <class SignalR, class SignalT, class T>
+auto FftBatch(SignalR&& out, const SignalT& in, size_t numChannels, FftBatchPlan<T>& plan)
+	-> decltype(plan.execute(AsView(out), AsView(in), numChannels)) {
+	return plan.execute(AsView(out), AsView(in), numChannels);
+}
+
+/// <summary> Transforms each signal in a list of signals or views using the same plan. </summary>
+/// <param name="numThreads"> The number of threads to use, 0 means all hardware threads. </param>
+template <class ContainerR, class ContainerT, class T>
+void FftBatch(ContainerR&& out, const ContainerT& in, FftPlan<T>& plan, size_t numThreads = 0) {
+	impl::ExecuteBatch(out, in, plan, numThreads, [](auto& o, const auto& i, FftPlan<T>& p) { Fft(o, i, p); });
+}
+
+/// <summary> Inverse transforms each spectrum in a list of spectra or views using the same plan. </summary>
+/// <param name="numThreads"> The number of threads to use, 0 means all hardware threads. </param>
+template <class ContainerR, class ContainerT, class T>
+void IfftBatch(ContainerR&& out, const ContainerT& in, FftPlan<T>& plan, size_t numThreads = 0) {
+	impl::ExecuteBatch(out, in, plan, numThreads, [](auto& o, const auto& i, FftPlan<T>& p) { Ifft(o, i, p); });
+}
+
 
 template <class SignalT>
 auto Fft(const SignalT& in, impl::FftFull) -> decltype(impl::Fft(AsView(in), FFT_FULL)) {
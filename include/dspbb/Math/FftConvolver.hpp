@@ -0,0 +1,119 @@
+#pragma once
+
+#include "../Math/FFT.hpp"
+#include "../Math/OverlapAdd.hpp"
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalArithmetic.hpp"
+#include "../Primitives/SignalView.hpp"
+
+#include <algorithm>
+
+
+namespace dspbb {
+
+/// <summary> Streaming convolution with a fixed filter using overlap-add. </summary>
+/// <remarks> The filter is transformed once on construction and the overlapping tail of the previous
+///		blocks is kept internally, so each block costs one forward and one inverse FFT.
+///		All memory is allocated on construction. </remarks>
+template <class T>
+class FftConvolver {
+	using complex_type = std::complex<remove_complex_t<T>>;
+
+public:
+	FftConvolver() = default;
+	/// <param name="filter"> The impulse response to convolve with. </param>
+	/// <param name="maxBlockSize"> The largest block that is processed with a single pair of FFTs. </param>
+	template <class SignalU, std::enable_if_t<is_signal_like_v<std::decay_t<SignalU>>, int> = 0>
+	FftConvolver(const SignalU& filter, size_t maxBlockSize);
+
+	size_t filterSize() const;
+	size_t maxBlockSize() const;
+	size_t fftSize() const;
+
+	/// <summary> Filters the next block of the input stream. </summary>
+	/// <remarks> Blocks longer than maxBlockSize are split and take multiple FFTs. </remarks>
+	void process(SignalView<T> out, SignalView<const T> in);
+	void reset();
+
+private:
+	void ProcessBlock(SignalView<T> out, SignalView<const T> in);
+
+private:
+	FftPlan<T> m_plan;
+	Spectrum<complex_type> m_filterFd;
+	Spectrum<complex_type> m_workingFd;
+	Signal<T> m_workingChunk;
+	Signal<T> m_tail;
+	size_t m_filterSize = 0;
+	size_t m_maxBlockSize = 0;
+};
+
+
+template <class T>
+template <class SignalU, std::enable_if_t<is_signal_like_v<std::decay_t<SignalU>>, int>>
+FftConvolver<T>::FftConvolver(const SignalU& filter, size_t maxBlockSize)
+	: m_plan(impl::ola::NextPowerOfTwo(maxBlockSize + filter.size() - 1)),
+	  m_filterSize(filter.size()),
+	  m_maxBlockSize(maxBlockSize) {
+	assert(!filter.empty());
+	assert(maxBlockSize > 0);
+
+	const size_t binCount = is_complex_v<T> ? fftSize() : fftSize() / 2 + 1;
+	m_filterFd.resize(binCount);
+	m_workingFd.resize(binCount);
+	m_workingChunk.resize(fftSize(), T(0));
+	m_tail.resize(fftSize(), T(0));
+
+	std::copy(filter.begin(), filter.end(), m_workingChunk.begin());
+	Fft(m_filterFd, m_workingChunk, m_plan);
+}
+
+template <class T>
+size_t FftConvolver<T>::filterSize() const {
+	return m_filterSize;
+}
+
+template <class T>
+size_t FftConvolver<T>::maxBlockSize() const {
+	return m_maxBlockSize;
+}
+
+template <class T>
+size_t FftConvolver<T>::fftSize() const {
+	return m_plan.size();
+}
+
+template <class T>
+void FftConvolver<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(out.size() == in.size());
+	for (size_t first = 0; first < in.size(); first += m_maxBlockSize) {
+		const size_t count = std::min(m_maxBlockSize, in.size() - first);
+		ProcessBlock(out.subsignal(first, count), in.subsignal(first, count));
+	}
+}
+
+template <class T>
+void FftConvolver<T>::reset() {
+	std::fill(m_tail.begin(), m_tail.end(), T(0));
+}
+
+template <class T>
+void FftConvolver<T>::ProcessBlock(SignalView<T> out, SignalView<const T> in) {
+	const size_t blockSize = in.size();
+	const size_t tailSize = m_filterSize - 1;
+	const size_t resultSize = blockSize + tailSize;
+
+	std::fill(std::copy(in.begin(), in.end(), m_workingChunk.begin()), m_workingChunk.end(), T(0));
+	Fft(m_workingFd, m_workingChunk, m_plan);
+	Multiply(m_workingFd, m_workingFd, m_filterFd);
+	Ifft(m_workingChunk, m_workingFd, m_plan);
+
+	// The tail holds the contributions of the previous blocks to samples from the start of this block onwards.
+	const auto tail = AsView(m_tail);
+	tail.subsignal(0, resultSize) += AsConstView(m_workingChunk).subsignal(0, resultSize);
+	std::copy(tail.begin(), tail.begin() + blockSize, out.begin());
+	std::copy(tail.begin() + blockSize, tail.begin() + resultSize, tail.begin());
+	std::fill(tail.begin() + tailSize, tail.begin() + resultSize, T(0));
+}
+
+} // namespace dspbb
@@ -3,9 +3,11 @@
 #include "../Math/Convolution.hpp"
 #include "../Math/FFT.hpp"
 #include "../Math/Solvers.hpp"
+#include "../Math/Tuning.hpp"
 #include "../Utility/Interval.hpp"
 
 #include <cmath>
+#include <stdexcept>
 
 namespace dspbb {
 
@@ -13,45 +15,169 @@ namespace impl {
 
 	namespace ola {
 
-		template <class SignalU>
-		auto FftFilter(const SignalU& filter, std::false_type, std::false_type) {
-			return Fft(filter, FFT_HALF);
+		template <class T>
+		constexpr size_t BinCount(size_t size) {
+			return is_complex_v<T> ? size : size / 2 + 1;
 		}
-		template <class SignalU>
-		auto FftFilter(const SignalU& filter, std::false_type, std::true_type) {
-			return Fft(filter);
+
+		// Holds the FFT plans and every intermediate buffer of the chunk loop, so that convolving
+		// a chunk does not allocate. Real operands are transformed to half spectra only, the redundant
+		// upper half is synthesized on the fly when they are multiplied with a complex operand.
+		template <class T, class U>
+		class Workspace {
+			using R = multiplies_result_t<T, U>;
+			template <class V>
+			using spectrum_type = Spectrum<std::complex<remove_complex_t<V>>>;
+
+		public:
+			Workspace() = default;
+			explicit Workspace(size_t chunkSize);
+
+			size_t chunkSize() const;
+
+			/// <summary> Zero-pads and transforms the filter. </summary>
+			template <class SignalU>
+			void setFilter(const SignalU& filter);
+			/// <summary> The input chunk, to be filled by the caller before calling convolveChunk. </summary>
+			SignalView<T> chunk();
+			/// <summary> Circularly convolves the input chunk with the filter. </summary>
+			SignalView<const R> convolveChunk();
+
+		private:
+			FftPlan<U>& FilterPlan();
+			FftPlan<R>& ProductPlan();
+
+		private:
+			FftPlan<T> m_chunkPlan;
+			FftPlan<U> m_filterPlan; // Only used when U differs from T.
+			FftPlan<R> m_productPlan; // Only used when R differs from both T and U.
+			Signal<T> m_chunk;
+			Signal<U> m_filter;
+			Signal<R> m_result;
+			spectrum_type<T> m_chunkFd;
+			spectrum_type<U> m_filterFd;
+			spectrum_type<R> m_productFd;
+		};
+
+		template <class T, class U>
+		Workspace<T, U>::Workspace(size_t chunkSize)
+			: m_chunkPlan(chunkSize),
+			  m_chunk(chunkSize, T(0)),
+			  m_filter(chunkSize, U(0)),
+			  m_result(chunkSize, R(remove_complex_t<R>(0))),
+			  m_chunkFd(BinCount<T>(chunkSize)),
+			  m_filterFd(BinCount<U>(chunkSize)),
+			  m_productFd(BinCount<R>(chunkSize)) {
+			if constexpr (!std::is_same_v<U, T>) {
+				m_filterPlan = FftPlan<U>(chunkSize);
+			}
+			if constexpr (!std::is_same_v<R, T> && !std::is_same_v<R, U>) {
+				m_productPlan = FftPlan<R>(chunkSize);
+			}
 		}
-		template <class SignalU>
-		auto FftFilter(const SignalU& filter, std::true_type, std::false_type) {
-			return Fft(filter, FFT_FULL);
+
+		template <class T, class U>
+		size_t Workspace<T, U>::chunkSize() const {
+			return m_chunk.size();
 		}
+
+		template <class T, class U>
 		template <class SignalU>
-		auto FftFilter(const SignalU& filter, std::true_type, std::true_type) {
-			return Fft(filter);
+		void Workspace<T, U>::setFilter(const SignalU& filter) {
+			if (filter.size() > chunkSize()) {
+				throw std::invalid_argument("The filter does not fit into the chunks of the workspace.");
+			}
+			std::fill(std::copy(filter.begin(), filter.end(), m_filter.begin()), m_filter.end(), U(0));
+			Fft(m_filterFd, m_filter, FilterPlan());
 		}
 
+		template <class T, class U>
+		SignalView<T> Workspace<T, U>::chunk() {
+			return AsView(m_chunk);
+		}
 
-		template <class SignalT, bool S, bool F>
-		auto FftChunk(const SignalT& chunk, std::integral_constant<bool, S>, std::integral_constant<bool, F>) {
-			// Same thing as filter, just reverse the order of the complexness parameters.
-			return FftFilter(chunk, std::integral_constant<bool, F>{}, std::integral_constant<bool, S>{});
+		template <class T, class U>
+		auto Workspace<T, U>::convolveChunk() -> SignalView<const R> {
+			Fft(m_chunkFd, m_chunk, m_chunkPlan);
+			if constexpr (is_complex_v<T> == is_complex_v<U>) {
+				Multiply(m_productFd, m_chunkFd, m_filterFd);
+			}
+			else if constexpr (is_complex_v<T>) {
+				MultiplyHermitian(m_productFd, m_chunkFd, AsHermitianView(m_filterFd, chunkSize()));
+			}
+			else {
+				MultiplyHermitian(m_productFd, m_filterFd, AsHermitianView(m_chunkFd, chunkSize()));
+			}
+			Ifft(m_result, m_productFd, ProductPlan());
+			return AsConstView(m_result);
 		}
 
-		template <class SpectrumT>
-		auto IfftChunk(const SpectrumT& fft, std::false_type, std::false_type, size_t fftSize) {
-			return Ifft(fft, FFT_HALF, fftSize % 2 == 0);
+		template <class T, class U>
+		FftPlan<U>& Workspace<T, U>::FilterPlan() {
+			if constexpr (std::is_same_v<U, T>) {
+				return m_chunkPlan;
+			}
+			else {
+				return m_filterPlan;
+			}
 		}
-		template <class SpectrumT>
-		auto IfftChunk(const SpectrumT& fft, std::false_type, std::true_type, size_t) {
-			return Ifft(fft);
+
+		template <class T, class U>
+		auto Workspace<T, U>::ProductPlan() -> FftPlan<R>& {
+			if constexpr (std::is_same_v<R, T>) {
+				return m_chunkPlan;
+			}
+			else if constexpr (std::is_same_v<R, U>) {
+				return FilterPlan();
+			}
+			else {
+				return m_productPlan;
+			}
 		}
-		template <class SpectrumT>
-		auto IfftChunk(const SpectrumT& fft, std::true_type, std::false_type, size_t) {
-			return Ifft(fft);
+
+		// The first input sample of the first chunk when the whole output is processed at once.
+		inline intptr_t GridFirst(size_t uSize, size_t vSize, size_t offset, size_t outSize) {
+			const Interval outExtent{ intptr_t(offset), intptr_t(offset + outSize) };
+			const Interval uExtent{ intptr_t(0), intptr_t(uSize) };
+			return Intersection(uExtent, EncompassingUnion(outExtent, outExtent + intptr_t(1) - intptr_t(vSize))).first;
 		}
-		template <class SpectrumT>
-		auto IfftChunk(const SpectrumT& fft, std::true_type, std::true_type, size_t) {
-			return Ifft(fft);
+
+		// Accumulates the filtered chunks of u that overlap the output into out. The chunks are laid
+		// out from gridFirst in steps of the filter size regardless of the output range, thus
+		// disjoint parts of the output can be processed separately, even on different threads,
+		// and every output sample still receives the same chunks in the same order.
+		template <class SignalR, class SignalT, class SignalU, class T, class U>
+		void AccumulateChunks(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset, intptr_t gridFirst, Workspace<T, U>& workspace) {
+			using Q = multiplies_result_t<T, U>;
+			constexpr eSignalDomain Domain = signal_traits<std::decay_t<SignalT>>::domain;
+
+			const intptr_t chunkSize = intptr_t(workspace.chunkSize());
+			const intptr_t step = intptr_t(v.size());
+			const Interval outExtent{ intptr_t(offset), intptr_t(offset + out.size()) };
+			const Interval uExtent{ intptr_t(0), intptr_t(u.size()) };
+
+			// Skip the chunks of the grid that end before the output starts.
+			intptr_t chunkFirst = gridFirst;
+			if (outExtent.first - chunkSize + 1 > chunkFirst) {
+				chunkFirst += (outExtent.first - chunkSize + 1 - chunkFirst + step - 1) / step * step;
+			}
+
+			const auto workingChunk = workspace.chunk();
+			Interval uInterval = { chunkFirst, chunkFirst + step };
+			Interval outInterval = { chunkFirst, chunkFirst + chunkSize };
+			for (; !IsDisjoint(outInterval, outExtent); uInterval += step, outInterval += step) {
+				Interval uValidInterval = Intersection(uInterval, uExtent);
+				const auto fillFirst = std::copy(u.begin() + uValidInterval.first, u.begin() + uValidInterval.last, workingChunk.begin());
+				std::fill(fillFirst, workingChunk.end(), T(0));
+
+				const auto filteredChunk = workspace.convolveChunk();
+
+				Interval outValidInterval = Intersection(outInterval, outExtent) - intptr_t(offset);
+				Interval chunkValidInterval = Intersection(outInterval, outExtent) - uInterval.first;
+
+				const BasicSignalView<const Q, Domain> validChunk{ filteredChunk.begin() + chunkValidInterval.first, size_t(chunkValidInterval.size()) };
+				AsView(out).subsignal(outValidInterval.first, outValidInterval.size()) += validChunk;
+			}
 		}
 
 		// Cost of doing OLA with fftSize=K, filterSize=F, and signal length N:
@@ -70,17 +196,13 @@ namespace impl {
 			return 2.0 * constFft * (filterSize / fftSize - 1.0);
 		}
 
-		// No damn clue about these constants.
-		// They depend on the CPU as well as the FFT algorithm and the vectorization of VMULPS and VADDPS.
+		// The constants depend on the CPU as well as the FFT algorithm and the vectorization of VMULPS and VADDPS.
+		// The defaults come from TuningProfile, use CalibrateTuningProfile to fit them to the current machine.
 		// Underestimating the constant for FFT and overestimating for MUL and ADD is less of an issue.
 		// ^ That will suggest larger FFT than optimal, with a small performance hit.
-		// Besides, if the user needs performance, he can benchmark the whole OLA and convolution himself!
-		constexpr double kFft = 6.0;
-		constexpr double kAdd = 1.0;
-		constexpr double kMul = 3.0;
 
 		// We can solve OlaCostDX = 0 with Newton's Method.
-		inline double OptimalTheoreticalSize(double filterSize, double constFft = kFft, double constAdd = kAdd, double constMul = kMul) {
+		inline double OptimalTheoreticalSize(double filterSize, double constFft, double constAdd, double constMul) {
 			auto myCostDX = [=](double fftSize) {
 				return CostDX(fftSize, filterSize, constFft, constAdd, constMul);
 			};
@@ -104,7 +226,7 @@ namespace impl {
 			return p;
 		}
 
-		inline size_t OptimalPracticalSize(size_t signalSize, size_t filterSize, double constFft = kFft, double constAdd = kAdd, double constMul = kMul) {
+		inline size_t OptimalPracticalSize(size_t signalSize, size_t filterSize, double constFft, double constAdd, double constMul) {
 			size_t maxUsefulSize = ConvolutionLength(signalSize, filterSize, CONV_FULL);
 			size_t suggestedSize = NextPowerOfTwo(size_t(OptimalTheoreticalSize(double(filterSize), constFft, constAdd, constMul)));
 			if (suggestedSize * 3 / 4 < maxUsefulSize) {
@@ -112,11 +234,60 @@ namespace impl {
 			}
 			return maxUsefulSize;
 		}
+
+		inline size_t OptimalPracticalSize(size_t signalSize, size_t filterSize, const TuningProfile& profile) {
+			return OptimalPracticalSize(signalSize, filterSize, profile.fft, profile.add, profile.mul);
+		}
+
+		inline size_t OptimalPracticalSize(size_t signalSize, size_t filterSize) {
+			return OptimalPracticalSize(signalSize, filterSize, GetTuningProfile());
+		}
+
+		// Estimated cost of the chunk loop in the units of the tuning profile. The loop advances by
+		// filterSize input samples per chunk, and each chunk is transformed forward and back,
+		// multiplied with the filter spectrum and accumulated into the output.
+		inline double Cost(size_t signalSize, size_t filterSize, size_t chunkSize, const TuningProfile& profile) {
+			const double chunkCount = std::ceil(double(signalSize) / double(filterSize));
+			const double size = double(chunkSize);
+			return chunkCount * (2.0 * profile.fft * size * std::log(size) + (profile.add + profile.mul) * size);
+		}
 	} // namespace ola
 
 } // namespace impl
 
 
+/// <summary> FFT plans and buffers that make repeated calls to OverlapAdd and OverlapSave allocation-free. </summary>
+/// <typeparam name="T"> The sample type of the longer operand, which is split into chunks. </typeparam>
+/// <typeparam name="U"> The sample type of the shorter operand, the filter. </typeparam>
+template <class T, class U = T>
+using OverlapWorkspace = impl::ola::Workspace<T, U>;
+
+
+/// <remarks> When the operand types differ, <paramref name="u"/> must be the longer one. </remarks>
+/// <exception cref="std::invalid_argument"> The operand types differ and <paramref name="u"/> is the shorter one. </exception>
+template <class SignalR, class SignalT, class SignalU, class T, class U, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset, OverlapWorkspace<T, U>& workspace, bool clearOut = true) {
+	static_assert(std::is_same_v<T, std::remove_cv_t<typename signal_traits<std::decay_t<SignalT>>::type>>, "Workspace does not match the type of the first operand.");
+	static_assert(std::is_same_v<U, std::remove_cv_t<typename signal_traits<std::decay_t<SignalU>>::type>>, "Workspace does not match the type of the second operand.");
+	if (u.size() < v.size()) {
+		if constexpr (std::is_same_v<T, U>) {
+			return OverlapAdd(out, v, u, offset, workspace, clearOut);
+		}
+		else {
+			throw std::invalid_argument("The first operand must be the longer one when using a workspace with mixed types.");
+		}
+	}
+	assert(workspace.chunkSize() >= 2 * v.size() - 1);
+	assert(offset + out.size() <= ConvolutionLength(u.size(), v.size(), CONV_FULL) && "Result is outside of full convolution, thus contains some true zeros. I mean, it's ok, but you are probably doing it wrong.");
+	using R = typename signal_traits<std::decay_t<SignalR>>::type;
+	if (clearOut) {
+		std::fill(out.begin(), out.end(), R(remove_complex_t<R>(0)));
+	}
+
+	workspace.setFilter(v);
+	impl::ola::AccumulateChunks(out, u, v, offset, impl::ola::GridFirst(u.size(), v.size(), offset, out.size()), workspace);
+}
+
 template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
 void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset, size_t chunkSize = 0, bool clearOut = true) {
 	if (u.size() < v.size()) {
@@ -125,45 +296,72 @@ void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset
 	if (chunkSize == 0) {
 		chunkSize = impl::ola::OptimalPracticalSize(u.size(), v.size());
 	}
+	using T = std::remove_cv_t<typename signal_traits<std::decay_t<SignalT>>::type>;
+	using U = std::remove_cv_t<typename signal_traits<std::decay_t<SignalU>>::type>;
+	OverlapWorkspace<T, U> workspace{ chunkSize };
+	OverlapAdd(out, u, v, offset, workspace, clearOut);
+}
+
+/// <summary> Splits the output into contiguous ranges and computes them on multiple threads. </summary>
+/// <remarks> Each thread transforms the chunks that overlap its range, the few chunks at the boundaries
+///		are transformed by both neighbours. The result is bitwise identical to the serial overlap-add. </remarks>
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset, ParallelExecution execution, size_t chunkSize = 0, bool clearOut = true) {
+	if (u.size() < v.size()) {
+		return OverlapAdd(out, v, u, offset, execution, chunkSize, clearOut);
+	}
+	if (chunkSize == 0) {
+		chunkSize = impl::ola::OptimalPracticalSize(u.size(), v.size());
+	}
 	assert(chunkSize >= 2 * v.size() - 1);
-	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
-	assert(offset + out.size() <= fullLength && "Result is outside of full convolution, thus contains some true zeros. I mean, it's ok, but you are probably doing it wrong.");
+	assert(offset + out.size() <= ConvolutionLength(u.size(), v.size(), CONV_FULL) && "Result is outside of full convolution, thus contains some true zeros. I mean, it's ok, but you are probably doing it wrong.");
+	using R = typename signal_traits<std::decay_t<SignalR>>::type;
 	if (clearOut) {
-		using R = typename signal_traits<std::decay_t<SignalR>>::type;
 		std::fill(out.begin(), out.end(), R(remove_complex_t<R>(0)));
 	}
 
 	using T = std::remove_cv_t<typename signal_traits<std::decay_t<SignalT>>::type>;
 	using U = std::remove_cv_t<typename signal_traits<std::decay_t<SignalU>>::type>;
-	constexpr eSignalDomain Domain = signal_traits<std::decay_t<SignalT>>::domain;
-	constexpr auto is_complex_t = std::integral_constant<bool, is_complex_v<T>>{};
-	constexpr auto is_complex_u = std::integral_constant<bool, is_complex_v<U>>{};
-
-	BasicSignal<U, Domain> filter(chunkSize, U(0));
-	std::copy(v.begin(), v.end(), filter.begin());
-	const auto filterFd = impl::ola::FftFilter(filter, is_complex_t, is_complex_u);
-
-	const Interval outExtent{ intptr_t(offset), intptr_t(offset + out.size()) };
-	const Interval uExtent{ intptr_t(0), intptr_t(u.size()) };
-	const Interval loopInterval = Intersection(uExtent, EncompassingUnion(outExtent, outExtent + intptr_t(1) - intptr_t(v.size())));
+	const intptr_t gridFirst = impl::ola::GridFirst(u.size(), v.size(), offset, out.size());
+	// Ranges shorter than a chunk would make the threads mostly transform the same boundary chunks.
+	const size_t numWorkers = impl::BatchWorkerCount(std::max(size_t(1), out.size() / chunkSize), execution.numThreads);
+	impl::ParallelRanges(out.size(), numWorkers, [&](size_t first, size_t last, size_t) {
+		OverlapWorkspace<T, U> workspace{ chunkSize };
+		workspace.setFilter(v);
+		impl::ola::AccumulateChunks(AsView(out).subsignal(first, last - first), u, v, offset + first, gridFirst, workspace);
+	});
+}
 
-	BasicSignal<T, Domain> workingChunk(chunkSize, T(0));
-	Interval uInterval = { loopInterval.first, loopInterval.first + intptr_t(v.size()) };
-	Interval outInterval = { loopInterval.first, loopInterval.first + intptr_t(chunkSize) };
-	for (; !IsDisjoint(outInterval, outExtent); uInterval += intptr_t(v.size()), outInterval += intptr_t(v.size())) {
-		Interval uValidInterval = Intersection(uInterval, uExtent);
-		const auto fillFirst = std::copy(u.begin() + uValidInterval.first, u.begin() + uValidInterval.last, workingChunk.begin());
-		std::fill(fillFirst, workingChunk.end(), T(0));
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvFull, ParallelExecution execution, size_t chunkSize = 0, bool clearOut = true) {
+	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	assert(out.size() == fullLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = 0;
+	OverlapAdd(out, u, v, offset, execution, chunkSize, clearOut);
+}
 
-		const auto workingChunkFd = impl::ola::FftChunk(workingChunk, is_complex_t, is_complex_u);
-		const auto filteredChunkFd = workingChunkFd * filterFd;
-		const auto filteredChunk = impl::ola::IfftChunk(filteredChunkFd, is_complex_t, is_complex_u, chunkSize);
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvCentral, ParallelExecution execution, size_t chunkSize = 0, bool clearOut = true) {
+	const size_t centralLength = ConvolutionLength(u.size(), v.size(), CONV_CENTRAL);
+	assert(out.size() == centralLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = std::min(u.size() - 1, v.size() - 1);
+	OverlapAdd(out, u, v, offset, execution, chunkSize, clearOut);
+}
 
-		Interval outValidInterval = Intersection(outInterval, outExtent) - intptr_t(offset);
-		Interval chunkValidInterval = Intersection(outInterval, outExtent) - uInterval.first;
+template <class SignalR, class SignalT, class SignalU, class T, class U, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvFull, OverlapWorkspace<T, U>& workspace, bool clearOut = true) {
+	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	assert(out.size() == fullLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = 0;
+	OverlapAdd(out, u, v, offset, workspace, clearOut);
+}
 
-		AsView(out).subsignal(outValidInterval.first, outValidInterval.size()) += AsView(filteredChunk).subsignal(chunkValidInterval.first, chunkValidInterval.size());
-	}
+template <class SignalR, class SignalT, class SignalU, class T, class U, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapAdd(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvCentral, OverlapWorkspace<T, U>& workspace, bool clearOut = true) {
+	const size_t centralLength = ConvolutionLength(u.size(), v.size(), CONV_CENTRAL);
+	assert(out.size() == centralLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = std::min(u.size() - 1, v.size() - 1);
+	OverlapAdd(out, u, v, offset, workspace, clearOut);
 }
 
 template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
@@ -209,4 +407,20 @@ auto OverlapAdd(const SignalT& u, const SignalU& v, impl::ConvCentral, size_t ch
 	return OverlapAdd(u, v, offset, length, chunkSize);
 }
 
+template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
+auto OverlapAdd(const SignalT& u, const SignalU& v, impl::ConvFull, ParallelExecution execution, size_t chunkSize = 0) {
+	using R = multiplies_result_t<typename signal_traits<std::decay_t<SignalT>>::type, typename signal_traits<std::decay_t<SignalU>>::type>;
+	BasicSignal<R, signal_traits<std::decay_t<SignalT>>::domain> out(ConvolutionLength(u.size(), v.size(), CONV_FULL));
+	OverlapAdd(out, u, v, CONV_FULL, execution, chunkSize);
+	return out;
+}
+
+template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
+auto OverlapAdd(const SignalT& u, const SignalU& v, impl::ConvCentral, ParallelExecution execution, size_t chunkSize = 0) {
+	using R = multiplies_result_t<typename signal_traits<std::decay_t<SignalT>>::type, typename signal_traits<std::decay_t<SignalU>>::type>;
+	BasicSignal<R, signal_traits<std::decay_t<SignalT>>::domain> out(ConvolutionLength(u.size(), v.size(), CONV_CENTRAL));
+	OverlapAdd(out, u, v, CONV_CENTRAL, execution, chunkSize);
+	return out;
+}
+
 } // namespace dspbb
\ No newline at end of file
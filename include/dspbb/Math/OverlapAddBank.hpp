@@ -0,0 +1,225 @@
+#pragma once
+
+#include "../Math/Convolution.hpp"
+#include "../Math/FFT.hpp"
+#include "../Math/OverlapAdd.hpp"
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalArithmetic.hpp"
+#include "../Primitives/SignalView.hpp"
+#include "../Utility/Interval.hpp"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace dspbb {
+
+/// <summary> Convolves one signal with a bank of equal-length filters using overlap-add. </summary>
+/// <remarks> The filters are transformed once on construction. Each input chunk is transformed once and its
+///		spectrum is multiplied with every filter spectrum, so a chunk costs one forward FFT and one inverse FFT
+///		per filter. The filters can be spread over multiple threads, each producing its own outputs. </remarks>
+template <class T>
+class OverlapAddBank {
+	using complex_type = std::complex<remove_complex_t<T>>;
+
+	struct Worker {
+		FftPlan<T> plan;
+		Spectrum<complex_type> productFd;
+		Signal<T> result;
+	};
+
+public:
+	OverlapAddBank() = default;
+	/// <param name="filters"> A list of signals or views of equal length. </param>
+	/// <param name="chunkSize"> The FFT size, 0 picks one from the tuning profile. </param>
+	template <class ContainerV>
+	explicit OverlapAddBank(const ContainerV& filters, size_t chunkSize = 0);
+
+	size_t numFilters() const;
+	size_t filterSize() const;
+	size_t chunkSize() const;
+
+	/// <summary> Computes outs[i] as the samples [offset, offset + outs[i].size()) of the full convolution of u and filter i. </summary>
+	/// <param name="outs"> A list of signals or views of equal length, one for each filter. </param>
+	template <class ContainerR, class SignalT>
+	void process(ContainerR& outs, const SignalT& u, size_t offset, bool clearOut = true);
+	template <class ContainerR, class SignalT>
+	void process(ContainerR& outs, const SignalT& u, impl::ConvFull, bool clearOut = true);
+	template <class ContainerR, class SignalT>
+	void process(ContainerR& outs, const SignalT& u, impl::ConvCentral, bool clearOut = true);
+
+	/// <summary> Same as the serial overloads, with the filters spread over multiple threads. </summary>
+	/// <remarks> Each filter's outputs are computed by a single thread, so the results are bitwise identical. </remarks>
+	template <class ContainerR, class SignalT>
+	void process(ContainerR& outs, const SignalT& u, size_t offset, ParallelExecution execution, bool clearOut = true);
+	template <class ContainerR, class SignalT>
+	void process(ContainerR& outs, const SignalT& u, impl::ConvFull, ParallelExecution execution, bool clearOut = true);
+	template <class ContainerR, class SignalT>
+	void process(ContainerR& outs, const SignalT& u, impl::ConvCentral, ParallelExecution execution, bool clearOut = true);
+
+private:
+	template <class ContainerR, class SignalT>
+	void ProcessImpl(ContainerR& outs, const SignalT& u, size_t offset, size_t numThreads, bool clearOut);
+	size_t BinCount() const;
+	void ReserveWorkers(size_t numWorkers);
+
+private:
+	// Chunks are transformed in batches, so that the workers are dispatched once per batch rather than per chunk.
+	static constexpr size_t chunksPerBatch = 16;
+
+	FftPlan<T> m_plan;
+	Spectrum<complex_type> m_filtersFd;
+	Spectrum<complex_type> m_chunksFd;
+	Signal<T> m_chunk;
+	std::vector<Worker> m_workers;
+	size_t m_numFilters = 0;
+	size_t m_filterSize = 0;
+};
+
+
+template <class T>
+template <class ContainerV>
+OverlapAddBank<T>::OverlapAddBank(const ContainerV& filters, size_t chunkSize)
+	: m_numFilters(filters.size()),
+	  m_filterSize(filters.size() > 0 ? filters.begin()->size() : 0) {
+	assert(m_numFilters > 0);
+	assert(m_filterSize > 0);
+	assert(std::all_of(filters.begin(), filters.end(), [this](const auto& filter) { return filter.size() == m_filterSize; }));
+
+	if (chunkSize == 0) {
+		const auto profile = GetTuningProfile();
+		const double optimalSize = m_filterSize > 1 ? impl::ola::OptimalTheoreticalSize(double(m_filterSize), profile.fft, profile.add, profile.mul) : 0.0;
+		chunkSize = impl::ola::NextPowerOfTwo(std::max(2 * m_filterSize - 1, size_t(optimalSize)));
+	}
+	assert(chunkSize >= m_filterSize);
+
+	m_plan = FftPlan<T>(chunkSize);
+	m_chunk.resize(chunkSize, T(0));
+	m_filtersFd.resize(m_numFilters * BinCount());
+	m_chunksFd.resize(chunksPerBatch * BinCount());
+
+	size_t index = 0;
+	for (const auto& filter : filters) {
+		std::fill(std::copy(filter.begin(), filter.end(), m_chunk.begin()), m_chunk.end(), T(0));
+		Fft(AsView(m_filtersFd).subsignal(index * BinCount(), BinCount()), m_chunk, m_plan);
+		++index;
+	}
+}
+
+template <class T>
+size_t OverlapAddBank<T>::numFilters() const {
+	return m_numFilters;
+}
+
+template <class T>
+size_t OverlapAddBank<T>::filterSize() const {
+	return m_filterSize;
+}
+
+template <class T>
+size_t OverlapAddBank<T>::chunkSize() const {
+	return m_plan.size();
+}
+
+template <class T>
+template <class ContainerR, class SignalT>
+void OverlapAddBank<T>::ProcessImpl(ContainerR& outs, const SignalT& u, size_t offset, size_t numThreads, bool clearOut) {
+	assert(outs.size() == m_numFilters);
+	const size_t length = outs.begin()->size();
+	assert(std::all_of(outs.begin(), outs.end(), [length](const auto& out) { return out.size() == length; }));
+	assert(offset + length <= ConvolutionLength(u.size(), m_filterSize, CONV_FULL));
+
+	if (clearOut) {
+		for (auto& out : outs) {
+			std::fill(out.begin(), out.end(), T(0));
+		}
+	}
+
+	// Each chunk takes step input samples and contributes to chunkSize output samples from the same position.
+	const size_t step = chunkSize() - m_filterSize + 1;
+	const size_t inFirst = offset > m_filterSize - 1 ? offset - (m_filterSize - 1) : 0;
+	const size_t inLast = std::min(u.size(), offset + length);
+	const size_t numChunks = inLast > inFirst ? (inLast - inFirst + step - 1) / step : 0;
+	const Interval outExtent{ intptr_t(offset), intptr_t(offset + length) };
+
+	const size_t numWorkers = impl::BatchWorkerCount(m_numFilters, numThreads);
+	ReserveWorkers(numWorkers);
+
+	for (size_t batchFirst = 0; batchFirst < numChunks; batchFirst += chunksPerBatch) {
+		const size_t batchSize = std::min(chunksPerBatch, numChunks - batchFirst);
+		for (size_t chunk = 0; chunk < batchSize; ++chunk) {
+			const size_t chunkFirst = inFirst + (batchFirst + chunk) * step;
+			const size_t chunkLast = std::min(chunkFirst + step, inLast);
+			std::fill(std::copy(u.begin() + chunkFirst, u.begin() + chunkLast, m_chunk.begin()), m_chunk.end(), T(0));
+			Fft(AsView(m_chunksFd).subsignal(chunk * BinCount(), BinCount()), m_chunk, m_plan);
+		}
+
+		impl::ParallelRanges(m_numFilters, numWorkers, [&](size_t first, size_t last, size_t workerIndex) {
+			Worker& worker = m_workers[workerIndex];
+			for (; first < last; ++first) {
+				const auto filterFd = AsConstView(m_filtersFd).subsignal(first * BinCount(), BinCount());
+				const auto out = AsView(*(outs.begin() + first));
+				for (size_t chunk = 0; chunk < batchSize; ++chunk) {
+					Multiply(worker.productFd, AsConstView(m_chunksFd).subsignal(chunk * BinCount(), BinCount()), filterFd);
+					Ifft(worker.result, worker.productFd, worker.plan);
+
+					const intptr_t chunkFirst = intptr_t(inFirst + (batchFirst + chunk) * step);
+					const Interval validInterval = Intersection(Interval{ chunkFirst, chunkFirst + intptr_t(chunkSize()) }, outExtent);
+					out.subsignal(validInterval.first - intptr_t(offset), validInterval.size()) += AsConstView(worker.result).subsignal(validInterval.first - chunkFirst, validInterval.size());
+				}
+			}
+		});
+	}
+}
+
+template <class T>
+template <class ContainerR, class SignalT>
+void OverlapAddBank<T>::process(ContainerR& outs, const SignalT& u, size_t offset, bool clearOut) {
+	ProcessImpl(outs, u, offset, 1, clearOut);
+}
+
+template <class T>
+template <class ContainerR, class SignalT>
+void OverlapAddBank<T>::process(ContainerR& outs, const SignalT& u, impl::ConvFull, bool clearOut) {
+	process(outs, u, CONV_FULL, ParallelExecution{ 1 }, clearOut);
+}
+
+template <class T>
+template <class ContainerR, class SignalT>
+void OverlapAddBank<T>::process(ContainerR& outs, const SignalT& u, impl::ConvCentral, bool clearOut) {
+	process(outs, u, CONV_CENTRAL, ParallelExecution{ 1 }, clearOut);
+}
+
+template <class T>
+template <class ContainerR, class SignalT>
+void OverlapAddBank<T>::process(ContainerR& outs, const SignalT& u, size_t offset, ParallelExecution execution, bool clearOut) {
+	ProcessImpl(outs, u, offset, execution.numThreads, clearOut);
+}
+
+template <class T>
+template <class ContainerR, class SignalT>
+void OverlapAddBank<T>::process(ContainerR& outs, const SignalT& u, impl::ConvFull, ParallelExecution execution, bool clearOut) {
+	assert(outs.begin()->size() == ConvolutionLength(u.size(), m_filterSize, CONV_FULL) && "Use ConvolutionLength to calculate output size properly.");
+	ProcessImpl(outs, u, 0, execution.numThreads, clearOut);
+}
+
+template <class T>
+template <class ContainerR, class SignalT>
+void OverlapAddBank<T>::process(ContainerR& outs, const SignalT& u, impl::ConvCentral, ParallelExecution execution, bool clearOut) {
+	assert(outs.begin()->size() == ConvolutionLength(u.size(), m_filterSize, CONV_CENTRAL) && "Use ConvolutionLength to calculate output size properly.");
+	ProcessImpl(outs, u, std::min(u.size() - 1, m_filterSize - 1), execution.numThreads, clearOut);
+}
+
+template <class T>
+size_t OverlapAddBank<T>::BinCount() const {
+	return impl::ola::BinCount<T>(chunkSize());
+}
+
+template <class T>
+void OverlapAddBank<T>::ReserveWorkers(size_t numWorkers) {
+	while (m_workers.size() < numWorkers) {
+		m_workers.push_back(Worker{ m_plan, Spectrum<complex_type>(BinCount()), Signal<T>(chunkSize()) });
+	}
+}
+
+} // namespace dspbb
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "../Math/Convolution.hpp"
+#include "../Math/FFT.hpp"
+#include "../Math/OverlapAdd.hpp"
+#include "../Utility/Interval.hpp"
+
+#include <stdexcept>
+
+
+namespace dspbb {
+
+// Overlap-save computes each chunk of the output from an overlapping chunk of the input and discards
+// the first filterSize-1 samples polluted by the circular convolution. The valid samples are written
+// to the output directly, so there is no accumulation step unlike in overlap-add.
+/// <remarks> When the operand types differ, <paramref name="u"/> must be the longer one. </remarks>
+/// <exception cref="std::invalid_argument"> The operand types differ and <paramref name="u"/> is the shorter one. </exception>
+template <class SignalR, class SignalT, class SignalU, class T, class U, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapSave(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset, OverlapWorkspace<T, U>& workspace, bool clearOut = true) {
+	static_assert(std::is_same_v<T, std::remove_cv_t<typename signal_traits<std::decay_t<SignalT>>::type>>, "Workspace does not match the type of the first operand.");
+	static_assert(std::is_same_v<U, std::remove_cv_t<typename signal_traits<std::decay_t<SignalU>>::type>>, "Workspace does not match the type of the second operand.");
+	if (u.size() < v.size()) {
+		if constexpr (std::is_same_v<T, U>) {
+			return OverlapSave(out, v, u, offset, workspace, clearOut);
+		}
+		else {
+			throw std::invalid_argument("The first operand must be the longer one when using a workspace with mixed types.");
+		}
+	}
+	const size_t chunkSize = workspace.chunkSize();
+	assert(chunkSize >= v.size());
+	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	assert(offset + out.size() <= fullLength && "Result is outside of full convolution, thus contains some true zeros. I mean, it's ok, but you are probably doing it wrong.");
+
+	using Q = multiplies_result_t<T, U>;
+	constexpr eSignalDomain Domain = signal_traits<std::decay_t<SignalT>>::domain;
+
+	workspace.setFilter(v);
+
+	const size_t overlap = v.size() - 1;
+	const size_t step = chunkSize - overlap;
+	const Interval uExtent{ intptr_t(0), intptr_t(u.size()) };
+
+	const auto workingChunk = workspace.chunk();
+	for (size_t outFirst = 0; outFirst < out.size(); outFirst += step) {
+		const intptr_t chunkFirst = intptr_t(offset + outFirst) - intptr_t(overlap);
+		const Interval uValidInterval = Intersection(Interval{ chunkFirst, chunkFirst + intptr_t(chunkSize) }, uExtent);
+		const auto copyFirst = workingChunk.begin() + (uValidInterval.first - chunkFirst);
+		std::fill(workingChunk.begin(), copyFirst, T(0));
+		const auto fillFirst = std::copy(u.begin() + uValidInterval.first, u.begin() + uValidInterval.last, copyFirst);
+		std::fill(fillFirst, workingChunk.end(), T(0));
+
+		const auto filteredChunk = workspace.convolveChunk();
+
+		const size_t count = std::min(step, out.size() - outFirst);
+		const auto outChunk = AsView(out).subsignal(outFirst, count);
+		const BasicSignalView<const Q, Domain> validChunk{ filteredChunk.begin() + overlap, count };
+		if (clearOut) {
+			std::copy(validChunk.begin(), validChunk.end(), outChunk.begin());
+		}
+		else {
+			outChunk += validChunk;
+		}
+	}
+}
+
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapSave(SignalR&& out, const SignalT& u, const SignalU& v, size_t offset, size_t chunkSize = 0, bool clearOut = true) {
+	if (u.size() < v.size()) {
+		return OverlapSave(out, v, u, offset, chunkSize, clearOut);
+	}
+	if (chunkSize == 0) {
+		chunkSize = impl::ola::OptimalPracticalSize(u.size(), v.size());
+	}
+	using T = std::remove_cv_t<typename signal_traits<std::decay_t<SignalT>>::type>;
+	using U = std::remove_cv_t<typename signal_traits<std::decay_t<SignalU>>::type>;
+	OverlapWorkspace<T, U> workspace{ chunkSize };
+	OverlapSave(out, u, v, offset, workspace, clearOut);
+}
+
+template <class SignalR, class SignalT, class SignalU, class T, class U, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapSave(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvFull, OverlapWorkspace<T, U>& workspace, bool clearOut = true) {
+	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	assert(out.size() == fullLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = 0;
+	OverlapSave(out, u, v, offset, workspace, clearOut);
+}
+
+template <class SignalR, class SignalT, class SignalU, class T, class U, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapSave(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvCentral, OverlapWorkspace<T, U>& workspace, bool clearOut = true) {
+	const size_t centralLength = ConvolutionLength(u.size(), v.size(), CONV_CENTRAL);
+	assert(out.size() == centralLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = std::min(u.size() - 1, v.size() - 1);
+	OverlapSave(out, u, v, offset, workspace, clearOut);
+}
+
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapSave(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvFull, size_t chunkSize = 0, bool clearOut = true) {
+	const size_t fullLength = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	assert(out.size() == fullLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = 0;
+	OverlapSave(out, u, v, offset, chunkSize, clearOut);
+}
+
+template <class SignalR, class SignalT, class SignalU, std::enable_if_t<is_mutable_signal_v<SignalR> && is_same_domain_v<SignalR, SignalT, SignalU>, int> = 0>
+void OverlapSave(SignalR&& out, const SignalT& u, const SignalU& v, impl::ConvCentral, size_t chunkSize = 0, bool clearOut = true) {
+	const size_t centralLength = ConvolutionLength(u.size(), v.size(), CONV_CENTRAL);
+	assert(out.size() == centralLength && "Use ConvolutionLength to calculate output size properly.");
+	size_t offset = std::min(u.size() - 1, v.size() - 1);
+	OverlapSave(out, u, v, offset, chunkSize, clearOut);
+}
+
+
+template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
+auto OverlapSave(const SignalT& u, const SignalU& v, size_t offset, size_t length, size_t chunkSize = 0) {
+	using T = typename signal_traits<std::decay_t<SignalT>>::type;
+	using U = typename signal_traits<std::decay_t<SignalU>>::type;
+	using R = multiplies_result_t<T, U>;
+	constexpr eSignalDomain Domain = signal_traits<std::decay_t<SignalT>>::domain;
+
+	BasicSignal<R, Domain> out(length, R(remove_complex_t<R>(0)));
+	OverlapSave(out, u, v, offset, chunkSize);
+	return out;
+}
+
+template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
+auto OverlapSave(const SignalT& u, const SignalU& v, impl::ConvFull, size_t chunkSize = 0) {
+	const size_t length = ConvolutionLength(u.size(), v.size(), CONV_FULL);
+	size_t offset = 0;
+	return OverlapSave(u, v, offset, length, chunkSize);
+}
+
+template <class SignalT, class SignalU, std::enable_if_t<is_same_domain_v<SignalT, SignalU>, int> = 0>
+auto OverlapSave(const SignalT& u, const SignalU& v, impl::ConvCentral, size_t chunkSize = 0) {
+	const size_t length = ConvolutionLength(u.size(), v.size(), CONV_CENTRAL);
+	size_t offset = std::min(u.size() - 1, v.size() - 1);
+	return OverlapSave(u, v, offset, length, chunkSize);
+}
+
+} // namespace dspbb
@@ -0,0 +1,469 @@
+#pragma once
+
+#include "../Math/Convolution.hpp"
+#include "../Math/FFT.hpp"
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalArithmetic.hpp"
+#include "../Primitives/SignalView.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace dspbb {
+
+//------------------------------------------------------------------------------
+// Uniformly partitioned convolution
+//------------------------------------------------------------------------------
+
+/// <summary> Streaming convolution with a long fixed filter split into partitions of equal size. </summary>
+/// <remarks> The spectra of the filter partitions are computed once. The spectra of the past input blocks are
+///		kept in a frequency-domain delay line, and the output is the sum of their products with the partitions,
+///		computed by uniformly partitioned overlap-save. The FFT size is twice the block size regardless of the
+///		filter length. Blocks of any size can be processed without added latency, but calls with exactly
+///		blockSize samples are the most efficient. All memory is allocated on construction. </remarks>
+template <class T>
+class PartitionedConvolver {
+	using complex_type = std::complex<remove_complex_t<T>>;
+
+public:
+	PartitionedConvolver() = default;
+	/// <param name="filter"> The impulse response to convolve with. </param>
+	/// <param name="blockSize"> The size of the filter partitions. </param>
+	template <class SignalU, std::enable_if_t<is_signal_like_v<std::decay_t<SignalU>>, int> = 0>
+	PartitionedConvolver(const SignalU& filter, size_t blockSize);
+
+	size_t filterSize() const;
+	size_t blockSize() const;
+	size_t partitionCount() const;
+
+	void process(SignalView<T> out, SignalView<const T> in);
+	void reset();
+
+private:
+	SpectrumView<complex_type> FilterPartition(size_t index);
+	SpectrumView<complex_type> DelayLine(size_t age);
+	void AccumulatePast();
+	void ProcessPartial(SignalView<T> out, SignalView<const T> in);
+
+private:
+	FftPlan<T> m_plan;
+	Spectrum<complex_type> m_filterFd;
+	Spectrum<complex_type> m_delayLine;
+	Spectrum<complex_type> m_past;
+	Spectrum<complex_type> m_workingFd;
+	Signal<T> m_input;
+	Signal<T> m_result;
+	size_t m_filterSize = 0;
+	size_t m_binCount = 0;
+	size_t m_head = 0;
+	size_t m_position = 0;
+};
+
+
+template <class T>
+template <class SignalU, std::enable_if_t<is_signal_like_v<std::decay_t<SignalU>>, int>>
+PartitionedConvolver<T>::PartitionedConvolver(const SignalU& filter, size_t blockSize)
+	: m_plan(2 * blockSize),
+	  m_filterSize(filter.size()),
+	  m_binCount(is_complex_v<T> ? 2 * blockSize : blockSize + 1) {
+	assert(!filter.empty());
+	assert(blockSize > 0);
+
+	const size_t numPartitions = (filter.size() + blockSize - 1) / blockSize;
+	m_filterFd.resize(numPartitions * m_binCount);
+	m_delayLine.resize(numPartitions * m_binCount, complex_type(0));
+	m_past.resize(m_binCount, complex_type(0));
+	m_workingFd.resize(m_binCount);
+	m_input.resize(2 * blockSize, T(0));
+	m_result.resize(2 * blockSize);
+
+	for (size_t index = 0; index < numPartitions; ++index) {
+		const size_t first = index * blockSize;
+		const size_t count = std::min(blockSize, filter.size() - first);
+		std::fill(std::copy(filter.begin() + first, filter.begin() + first + count, m_result.begin()), m_result.end(), T(0));
+		Fft(FilterPartition(index), m_result, m_plan);
+	}
+}
+
+template <class T>
+size_t PartitionedConvolver<T>::filterSize() const {
+	return m_filterSize;
+}
+
+template <class T>
+size_t PartitionedConvolver<T>::blockSize() const {
+	return m_plan.size() / 2;
+}
+
+template <class T>
+size_t PartitionedConvolver<T>::partitionCount() const {
+	return m_binCount == 0 ? 0 : m_filterFd.size() / m_binCount;
+}
+
+template <class T>
+void PartitionedConvolver<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(out.size() == in.size());
+	size_t first = 0;
+	while (first < in.size()) {
+		const size_t count = std::min(blockSize() - m_position, in.size() - first);
+		ProcessPartial(out.subsignal(first, count), in.subsignal(first, count));
+		first += count;
+	}
+}
+
+template <class T>
+void PartitionedConvolver<T>::reset() {
+	std::fill(m_delayLine.begin(), m_delayLine.end(), complex_type(0));
+	std::fill(m_past.begin(), m_past.end(), complex_type(0));
+	std::fill(m_input.begin(), m_input.end(), T(0));
+	m_head = 0;
+	m_position = 0;
+}
+
+template <class T>
+SpectrumView<typename PartitionedConvolver<T>::complex_type> PartitionedConvolver<T>::FilterPartition(size_t index) {
+	return AsView(m_filterFd).subsignal(index * m_binCount, m_binCount);
+}
+
+template <class T>
+SpectrumView<typename PartitionedConvolver<T>::complex_type> PartitionedConvolver<T>::DelayLine(size_t age) {
+	const size_t slot = (m_head + partitionCount() - age) % partitionCount();
+	return AsView(m_delayLine).subsignal(slot * m_binCount, m_binCount);
+}
+
+// The contribution of the previous blocks does not change while the current block is being filled,
+// so it's computed only once per block.
+template <class T>
+void PartitionedConvolver<T>::AccumulatePast() {
+	std::fill(m_past.begin(), m_past.end(), complex_type(0));
+	for (size_t age = 1; age < partitionCount(); ++age) {
+		Multiply(m_workingFd, DelayLine(age), FilterPartition(age));
+		m_past += m_workingFd;
+	}
+}
+
+template <class T>
+void PartitionedConvolver<T>::ProcessPartial(SignalView<T> out, SignalView<const T> in) {
+	const size_t blockSize = this->blockSize();
+	if (m_position == 0) {
+		AccumulatePast();
+	}
+
+	// The second half of the input holds the current block, the first half the previous one.
+	// The not yet received part of the current block is zero.
+	std::copy(in.begin(), in.end(), m_input.begin() + blockSize + m_position);
+	const auto current = DelayLine(0);
+	Fft(current, m_input, m_plan);
+	Multiply(m_workingFd, current, FilterPartition(0));
+	m_workingFd += m_past;
+	Ifft(m_result, m_workingFd, m_plan);
+	std::copy(m_result.begin() + blockSize + m_position, m_result.begin() + blockSize + m_position + in.size(), out.begin());
+
+	m_position += in.size();
+	if (m_position == blockSize) {
+		std::copy(m_input.begin() + blockSize, m_input.end(), m_input.begin());
+		std::fill(m_input.begin() + blockSize, m_input.end(), T(0));
+		m_head = (m_head + 1) % partitionCount();
+		m_position = 0;
+	}
+}
+
+
+//------------------------------------------------------------------------------
+// Non-uniformly partitioned convolution
+//------------------------------------------------------------------------------
+
+/// <summary> Streaming zero-latency convolution with a long fixed filter. </summary>
+/// <remarks> The head of the filter, the first blockSize taps, is convolved directly in the time domain.
+///		The rest is split into segments covered by uniformly partitioned convolvers with block sizes
+///		blockSize, 2*blockSize, 4*blockSize, ..., up to maxBlockSize. Every segment starts at least one of its blocks
+///		after the start of the filter, so its result is computed before it's needed.
+///		Latency guarantee: each call to process returns the output for all of its input, regardless of block
+///		sizes and whether the background thread is used. If the background thread falls behind,
+///		process waits for it, so the output is bitwise identical in both modes. </remarks>
+template <class T>
+class NonUniformConvolver {
+	struct Stage {
+		PartitionedConvolver<T> convolver;
+		Signal<T> input;
+		Signal<T> taskInput;
+		Signal<T> output;
+		size_t offset = 0;
+		size_t blockStart = 0;
+
+		size_t BlockSize() const { return input.size(); }
+		void ProcessBlock(SignalView<const T> block) {
+			convolver.process(AsView(output).subsignal(blockStart % output.size(), BlockSize()), block);
+		}
+	};
+
+	class Worker {
+	public:
+		Worker(Stage* stages, size_t numStages);
+		~Worker();
+		void Submit(size_t stage);
+		void Wait(size_t stage);
+		bool IsPending(size_t stage);
+
+	private:
+		void Run();
+
+	private:
+		enum class eState {
+			IDLE,
+			QUEUED,
+			RUNNING,
+		};
+		Stage* m_stages;
+		std::vector<eState> m_states;
+		std::mutex m_mutex;
+		std::condition_variable m_submitted;
+		std::condition_variable m_finished;
+		bool m_stop = false;
+		std::thread m_thread;
+	};
+
+public:
+	NonUniformConvolver() = default;
+	/// <param name="filter"> The impulse response to convolve with. </param>
+	/// <param name="blockSize"> The length of the directly convolved head and the smallest FFT block. </param>
+	/// <param name="maxBlockSize"> The FFT blocks stop growing at this size, a multiple of blockSize. 0 means no limit. </param>
+	/// <param name="backgroundThread"> Compute the segments after the first on a background thread. </param>
+	template <class SignalU, std::enable_if_t<is_signal_like_v<std::decay_t<SignalU>>, int> = 0>
+	NonUniformConvolver(const SignalU& filter, size_t blockSize, size_t maxBlockSize = 0, bool backgroundThread = false);
+	NonUniformConvolver(NonUniformConvolver&&) noexcept = default;
+	NonUniformConvolver& operator=(NonUniformConvolver&&) noexcept = default;
+	~NonUniformConvolver();
+
+	size_t filterSize() const;
+	size_t blockSize() const;
+	/// <summary> The number of samples the output lags behind the input. Always zero. </summary>
+	size_t latency() const;
+	/// <summary> The block sizes of the frequency-domain segments. </summary>
+	std::vector<size_t> segmentBlockSizes() const;
+
+	void process(SignalView<T> out, SignalView<const T> in);
+	void reset();
+
+private:
+	void ProcessSlice(SignalView<T> out, SignalView<const T> in);
+	void ProcessHead(SignalView<T> out, SignalView<const T> in);
+
+private:
+	// Declared first so that move assignment stops the old worker before the stages it works on are replaced.
+	// Members are destroyed in reverse order, so the destructor stops the worker explicitly before the stages go away.
+	std::unique_ptr<Worker> m_worker;
+	std::vector<Stage> m_stages;
+	Signal<T> m_head;
+	Signal<T> m_headInput;
+	size_t m_filterSize = 0;
+	size_t m_time = 0;
+};
+
+
+template <class T>
+NonUniformConvolver<T>::Worker::Worker(Stage* stages, size_t numStages)
+	: m_stages(stages), m_states(numStages, eState::IDLE), m_thread([this] { Run(); }) {}
+
+template <class T>
+NonUniformConvolver<T>::Worker::~Worker() {
+	{
+		std::lock_guard lk(m_mutex);
+		m_stop = true;
+	}
+	m_submitted.notify_all();
+	m_thread.join();
+}
+
+template <class T>
+void NonUniformConvolver<T>::Worker::Submit(size_t stage) {
+	{
+		std::lock_guard lk(m_mutex);
+		assert(m_states[stage] == eState::IDLE);
+		m_states[stage] = eState::QUEUED;
+	}
+	m_submitted.notify_one();
+}
+
+template <class T>
+void NonUniformConvolver<T>::Worker::Wait(size_t stage) {
+	std::unique_lock lk(m_mutex);
+	m_finished.wait(lk, [&] { return m_states[stage] == eState::IDLE; });
+}
+
+template <class T>
+bool NonUniformConvolver<T>::Worker::IsPending(size_t stage) {
+	std::lock_guard lk(m_mutex);
+	return m_states[stage] != eState::IDLE;
+}
+
+template <class T>
+void NonUniformConvolver<T>::Worker::Run() {
+	std::unique_lock lk(m_mutex);
+	while (true) {
+		// Smaller segments are needed sooner, so they are picked first.
+		const auto findQueued = [&] { return std::find(m_states.begin(), m_states.end(), eState::QUEUED); };
+		m_submitted.wait(lk, [&] { return m_stop || findQueued() != m_states.end(); });
+		const auto queued = findQueued();
+		if (queued == m_states.end()) {
+			return;
+		}
+		*queued = eState::RUNNING;
+		Stage& stage = m_stages[queued - m_states.begin()];
+		lk.unlock();
+		stage.ProcessBlock(AsConstView(stage.taskInput));
+		lk.lock();
+		*queued = eState::IDLE;
+		m_finished.notify_all();
+	}
+}
+
+template <class T>
+template <class SignalU, std::enable_if_t<is_signal_like_v<std::decay_t<SignalU>>, int>>
+NonUniformConvolver<T>::NonUniformConvolver(const SignalU& filter, size_t blockSize, size_t maxBlockSize, bool backgroundThread)
+	: m_filterSize(filter.size()) {
+	assert(!filter.empty());
+	assert(blockSize > 0);
+	assert(maxBlockSize % blockSize == 0);
+
+	const size_t headSize = std::min(blockSize, filter.size());
+	m_head.resize(headSize);
+	std::copy(filter.begin(), filter.begin() + headSize, m_head.begin());
+	m_headInput.resize(headSize - 1 + blockSize, T(0));
+
+	// Segment k starts at (2^(k+1) - 1) * blockSize with a block size of 2^k * blockSize.
+	// Once the block size is capped, the last segment covers the rest of the filter.
+	size_t offset = headSize;
+	size_t segmentBlockSize = blockSize;
+	while (offset < filter.size()) {
+		const bool isCapped = maxBlockSize != 0 && segmentBlockSize >= maxBlockSize;
+		segmentBlockSize = isCapped ? maxBlockSize : segmentBlockSize;
+		const size_t length = isCapped ? filter.size() - offset : std::min(2 * segmentBlockSize, filter.size() - offset);
+		const size_t outputSize = (offset + 2 * segmentBlockSize - 1) / segmentBlockSize * segmentBlockSize;
+
+		Stage stage;
+		stage.convolver = PartitionedConvolver<T>{ AsConstView(filter).subsignal(offset, length), segmentBlockSize };
+		stage.input.resize(segmentBlockSize, T(0));
+		stage.taskInput.resize(backgroundThread ? segmentBlockSize : 0, T(0));
+		stage.output.resize(outputSize, T(0));
+		stage.offset = offset;
+		m_stages.push_back(std::move(stage));
+
+		offset += length;
+		segmentBlockSize *= 2;
+	}
+
+	if (backgroundThread && !m_stages.empty()) {
+		m_worker = std::make_unique<Worker>(m_stages.data(), m_stages.size());
+	}
+}
+
+template <class T>
+NonUniformConvolver<T>::~NonUniformConvolver() {
+	m_worker.reset();
+}
+
+template <class T>
+size_t NonUniformConvolver<T>::filterSize() const {
+	return m_filterSize;
+}
+
+template <class T>
+size_t NonUniformConvolver<T>::blockSize() const {
+	return m_headInput.size() - m_head.size() + 1;
+}
+
+template <class T>
+size_t NonUniformConvolver<T>::latency() const {
+	return 0;
+}
+
+template <class T>
+std::vector<size_t> NonUniformConvolver<T>::segmentBlockSizes() const {
+	std::vector<size_t> sizes;
+	for (const auto& stage : m_stages) {
+		sizes.push_back(stage.BlockSize());
+	}
+	return sizes;
+}
+
+template <class T>
+void NonUniformConvolver<T>::process(SignalView<T> out, SignalView<const T> in) {
+	assert(out.size() == in.size());
+	size_t first = 0;
+	while (first < in.size()) {
+		// Slices never straddle the smallest block boundary, so neither the head input nor the segment outputs wrap.
+		const size_t count = std::min(blockSize() - m_time % blockSize(), in.size() - first);
+		ProcessSlice(out.subsignal(first, count), in.subsignal(first, count));
+		first += count;
+	}
+}
+
+template <class T>
+void NonUniformConvolver<T>::reset() {
+	for (size_t index = 0; index < m_stages.size(); ++index) {
+		if (m_worker) {
+			m_worker->Wait(index);
+		}
+		Stage& stage = m_stages[index];
+		stage.convolver.reset();
+		std::fill(stage.input.begin(), stage.input.end(), T(0));
+		std::fill(stage.output.begin(), stage.output.end(), T(0));
+	}
+	std::fill(m_headInput.begin(), m_headInput.end(), T(0));
+	m_time = 0;
+}
+
+template <class T>
+void NonUniformConvolver<T>::ProcessSlice(SignalView<T> out, SignalView<const T> in) {
+	const size_t count = in.size();
+	ProcessHead(out, in);
+
+	for (size_t index = 0; index < m_stages.size(); ++index) {
+		Stage& stage = m_stages[index];
+		if (m_time >= stage.offset) {
+			if (m_worker && m_time + count > stage.blockStart + stage.offset) {
+				m_worker->Wait(index);
+			}
+			const size_t readFirst = (m_time - stage.offset) % stage.output.size();
+			out += AsConstView(stage.output).subsignal(readFirst, count);
+		}
+	}
+
+	for (size_t index = 0; index < m_stages.size(); ++index) {
+		Stage& stage = m_stages[index];
+		const size_t position = m_time % stage.BlockSize();
+		std::copy(in.begin(), in.end(), stage.input.begin() + position);
+		if (position + count == stage.BlockSize()) {
+			if (m_worker) {
+				m_worker->Wait(index);
+				stage.blockStart = m_time + count - stage.BlockSize();
+				std::copy(stage.input.begin(), stage.input.end(), stage.taskInput.begin());
+				m_worker->Submit(index);
+			}
+			else {
+				stage.blockStart = m_time + count - stage.BlockSize();
+				stage.ProcessBlock(AsConstView(stage.input));
+			}
+		}
+	}
+
+	m_time += count;
+}
+
+template <class T>
+void NonUniformConvolver<T>::ProcessHead(SignalView<T> out, SignalView<const T> in) {
+	const size_t historySize = m_head.size() - 1;
+	const size_t count = in.size();
+	std::copy(in.begin(), in.end(), m_headInput.begin() + historySize);
+	const auto input = AsConstView(m_headInput).subsignal(0, historySize + count);
+	Convolution(out, input, m_head, historySize);
+	std::copy(m_headInput.begin() + count, m_headInput.begin() + count + historySize, m_headInput.begin());
+}
+
+} // namespace dspbb
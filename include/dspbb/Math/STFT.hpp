@@ -0,0 +1,277 @@
+#pragma once
+
+#include "../Math/FFT.hpp"
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalArithmetic.hpp"
+#include "../Primitives/SignalView.hpp"
+
+#include <algorithm>
+
+
+namespace dspbb {
+
+//------------------------------------------------------------------------------
+// Analysis
+//------------------------------------------------------------------------------
+
+/// <summary> Streaming short-time Fourier transform. </summary>
+/// <remarks> The input can be fed in blocks of any size, frames are emitted as soon as enough samples are available.
+///		Up to batchSize frames are windowed and then transformed together with an FftBatchPlan, several frames per pass.
+///		All memory is allocated on construction. </remarks>
+template <class T>
+class Stft {
+public:
+	using real_type = remove_complex_t<T>;
+	using complex_type = std::complex<real_type>;
+
+public:
+	Stft() = default;
+	/// <param name="window"> The analysis window, its length determines the frame size. </param>
+	/// <param name="hopSize"> The number of samples between the starts of consecutive frames. </param>
+	/// <param name="fftSize"> The frames are zero-padded to this length. 0 means the frame size. </param>
+	/// <param name="batchSize"> The most frames that are windowed before transforming them together.
+	///		Multiples of FftBatchPlan::lanes() keep every pass of the batched FFT fully occupied. </param>
+	Stft(SignalView<const real_type> window, size_t hopSize, size_t fftSize = 0, size_t batchSize = 16);
+
+	size_t frameSize() const;
+	size_t hopSize() const;
+	size_t fftSize() const;
+	/// <summary> The number of frequency bins per frame: the half spectrum for real, the full spectrum for complex input. </summary>
+	size_t binCount() const;
+	/// <summary> The number of frames the next call to feed will emit for an input of given size. </summary>
+	size_t frameCount(size_t inputSize) const;
+
+	/// <summary> Consumes the input and writes the completed frames one after another into the spectrogram. </summary>
+	/// <param name="spectrogram"> Must have room for at least frameCount(input.size()) * binCount() bins. </param>
+	/// <returns> The number of frames written. </returns>
+	size_t feed(SpectrumView<complex_type> spectrogram, SignalView<const T> input);
+	void reset();
+
+private:
+	void WindowFrame(SignalView<T> frame, SignalView<const T> input, size_t frameStart) const;
+
+private:
+	FftBatchPlan<T> m_plan;
+	Signal<real_type> m_window;
+	Signal<T> m_frames;
+	Signal<T> m_buffer;
+	size_t m_hopSize = 0;
+	size_t m_batchSize = 0;
+	size_t m_buffered = 0;
+	size_t m_skip = 0;
+};
+
+template <class T>
+Stft<T>::Stft(SignalView<const real_type> window, size_t hopSize, size_t fftSize, size_t batchSize)
+	: m_plan(fftSize == 0 ? window.size() : fftSize),
+	  m_window(window.begin(), window.end()),
+	  m_frames(std::max(size_t(1), batchSize) * (fftSize == 0 ? window.size() : fftSize), T(0)),
+	  m_buffer(window.size(), T(0)),
+	  m_hopSize(hopSize),
+	  m_batchSize(std::max(size_t(1), batchSize)) {
+	assert(!window.empty());
+	assert(hopSize > 0);
+	assert(m_plan.size() >= window.size());
+}
+
+template <class T>
+size_t Stft<T>::frameSize() const {
+	return m_window.size();
+}
+
+template <class T>
+size_t Stft<T>::hopSize() const {
+	return m_hopSize;
+}
+
+template <class T>
+size_t Stft<T>::fftSize() const {
+	return m_plan.size();
+}
+
+template <class T>
+size_t Stft<T>::binCount() const {
+	return is_complex_v<T> ? fftSize() : fftSize() / 2 + 1;
+}
+
+template <class T>
+size_t Stft<T>::frameCount(size_t inputSize) const {
+	const size_t available = m_buffered + inputSize - std::min(m_skip, inputSize);
+	return available < frameSize() ? 0 : (available - frameSize()) / m_hopSize + 1;
+}
+
+template <class T>
+size_t Stft<T>::feed(SpectrumView<complex_type> spectrogram, SignalView<const T> input) {
+	assert(spectrogram.size() >= frameCount(input.size()) * binCount());
+
+	const size_t skipped = std::min(m_skip, input.size());
+	input = input.subsignal(skipped);
+	m_skip -= skipped;
+
+	// Frame positions are relative to the start of the buffered samples followed by the input.
+	const size_t available = m_buffered + input.size();
+	size_t frameStart = 0;
+	size_t numFrames = 0;
+	while (frameStart + frameSize() <= available) {
+		size_t batch = 0;
+		for (; batch < m_batchSize && frameStart + frameSize() <= available; ++batch, frameStart += m_hopSize) {
+			WindowFrame(AsView(m_frames).subsignal(batch * fftSize(), frameSize()), input, frameStart);
+		}
+		m_plan.execute(spectrogram.subsignal(numFrames * binCount(), batch * binCount()), AsConstView(m_frames).subsignal(0, batch * fftSize()), batch);
+		numFrames += batch;
+	}
+
+	if (frameStart >= available) {
+		m_skip += frameStart - available;
+		m_buffered = 0;
+	}
+	else if (frameStart < m_buffered) {
+		const auto inputFirst = std::copy(m_buffer.begin() + frameStart, m_buffer.begin() + m_buffered, m_buffer.begin());
+		std::copy(input.begin(), input.end(), inputFirst);
+		m_buffered = available - frameStart;
+	}
+	else {
+		std::copy(input.begin() + (frameStart - m_buffered), input.end(), m_buffer.begin());
+		m_buffered = available - frameStart;
+	}
+	return numFrames;
+}
+
+template <class T>
+void Stft<T>::reset() {
+	m_buffered = 0;
+	m_skip = 0;
+}
+
+template <class T>
+void Stft<T>::WindowFrame(SignalView<T> frame, SignalView<const T> input, size_t frameStart) const {
+	const size_t fromBuffer = frameStart < m_buffered ? std::min(m_buffered - frameStart, frameSize()) : 0;
+	const size_t inputStart = frameStart + fromBuffer - m_buffered;
+	const size_t fromInput = frameSize() - fromBuffer;
+	const size_t bufferStart = fromBuffer > 0 ? frameStart : 0;
+	const auto window = AsConstView(m_window);
+	Multiply(frame.subsignal(0, fromBuffer), AsConstView(m_buffer).subsignal(bufferStart, fromBuffer), window.subsignal(0, fromBuffer));
+	Multiply(frame.subsignal(fromBuffer), input.subsignal(inputStart, fromInput), window.subsignal(fromBuffer));
+}
+
+
+//------------------------------------------------------------------------------
+// Synthesis
+//------------------------------------------------------------------------------
+
+/// <summary> Streaming inverse short-time Fourier transform by weighted overlap-add. </summary>
+/// <remarks> The frames are inverse transformed, weighted by the synthesis window, and accumulated like
+///		the chunks of OverlapAdd. The weights are normalized so that the round trip through an Stft with
+///		the same analysis window and hop reconstructs the input. All memory is allocated on construction. </remarks>
+template <class T>
+class Istft {
+public:
+	using real_type = remove_complex_t<T>;
+	using complex_type = std::complex<real_type>;
+
+public:
+	Istft() = default;
+	/// <param name="analysisWindow"> The window that the frames were analyzed with, its length determines the frame size. </param>
+	/// <param name="synthesisWindow"> The window applied to the resynthesized frames. Same length as the analysis window. </param>
+	/// <param name="hopSize"> The number of samples between the starts of consecutive frames. </param>
+	/// <param name="fftSize"> The size of the frames' spectra. 0 means the frame size. </param>
+	Istft(SignalView<const real_type> analysisWindow, SignalView<const real_type> synthesisWindow, size_t hopSize, size_t fftSize = 0);
+	/// <summary> Uses the analysis window for synthesis as well. </summary>
+	Istft(SignalView<const real_type> window, size_t hopSize, size_t fftSize = 0);
+
+	size_t frameSize() const;
+	size_t hopSize() const;
+	size_t fftSize() const;
+	size_t binCount() const;
+
+	/// <summary> Resynthesizes the frames of the spectrogram and writes hopSize samples per frame to the output. </summary>
+	/// <param name="out"> Must have room for at least hopSize() samples per frame. </param>
+	/// <param name="spectrogram"> The frames one after another, each binCount() long. </param>
+	/// <returns> The number of samples written. </returns>
+	size_t feed(SignalView<T> out, SpectrumView<const complex_type> spectrogram);
+	void reset();
+
+private:
+	FftPlan<T> m_plan;
+	Signal<real_type> m_window;
+	Signal<T> m_frame;
+	Signal<T> m_tail;
+	size_t m_hopSize = 0;
+};
+
+template <class T>
+Istft<T>::Istft(SignalView<const real_type> analysisWindow, SignalView<const real_type> synthesisWindow, size_t hopSize, size_t fftSize)
+	: m_plan(fftSize == 0 ? analysisWindow.size() : fftSize),
+	  m_window(synthesisWindow.begin(), synthesisWindow.end()),
+	  m_frame(fftSize == 0 ? analysisWindow.size() : fftSize, T(0)),
+	  m_tail(std::max(analysisWindow.size(), hopSize), T(0)),
+	  m_hopSize(hopSize) {
+	assert(!analysisWindow.empty());
+	assert(analysisWindow.size() == synthesisWindow.size());
+	assert(hopSize > 0);
+	assert(m_plan.size() >= analysisWindow.size());
+
+	// Every output sample is the sum of the overlapping frames, weighted by the product of the analysis and
+	// synthesis windows. The sum of the weights is periodic in the hop size, so it's folded into the window.
+	Signal<real_type> weightSums(hopSize, real_type(0));
+	for (size_t i = 0; i < frameSize(); ++i) {
+		weightSums[i % hopSize] += analysisWindow[i] * synthesisWindow[i];
+	}
+	for (size_t i = 0; i < frameSize(); ++i) {
+		const real_type weightSum = weightSums[i % hopSize];
+		m_window[i] = weightSum != real_type(0) ? m_window[i] / weightSum : real_type(0);
+	}
+}
+
+template <class T>
+Istft<T>::Istft(SignalView<const real_type> window, size_t hopSize, size_t fftSize)
+	: Istft(window, window, hopSize, fftSize) {}
+
+template <class T>
+size_t Istft<T>::frameSize() const {
+	return m_window.size();
+}
+
+template <class T>
+size_t Istft<T>::hopSize() const {
+	return m_hopSize;
+}
+
+template <class T>
+size_t Istft<T>::fftSize() const {
+	return m_plan.size();
+}
+
+template <class T>
+size_t Istft<T>::binCount() const {
+	return is_complex_v<T> ? fftSize() : fftSize() / 2 + 1;
+}
+
+template <class T>
+size_t Istft<T>::feed(SignalView<T> out, SpectrumView<const complex_type> spectrogram) {
+	const size_t numFrames = spectrogram.size() / binCount();
+	assert(spectrogram.size() == numFrames * binCount());
+	assert(out.size() >= numFrames * m_hopSize);
+
+	const auto frame = AsView(m_frame).subsignal(0, frameSize());
+	const auto tail = AsView(m_tail);
+	for (size_t i = 0; i < numFrames; ++i) {
+		m_plan.execute(AsView(m_frame), spectrogram.subsignal(i * binCount(), binCount()));
+		Multiply(frame, frame, m_window);
+		tail.subsignal(0, frameSize()) += frame;
+
+		// The first hop of the tail has received contributions from all frames overlapping it.
+		std::copy(tail.begin(), tail.begin() + m_hopSize, out.begin() + i * m_hopSize);
+		std::copy(tail.begin() + m_hopSize, tail.end(), tail.begin());
+		std::fill(tail.end() - m_hopSize, tail.end(), T(0));
+	}
+	return numFrames * m_hopSize;
+}
+
+template <class T>
+void Istft<T>::reset() {
+	std::fill(m_tail.begin(), m_tail.end(), T(0));
+}
+
+
+} // namespace dspbb
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "../Math/Convolution.hpp"
+#include "../Math/FFT.hpp"
+#include "../Primitives/Signal.hpp"
+#include "../Primitives/SignalArithmetic.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace dspbb {
+
+/// <summary> Machine-specific constants of the cost models that pick FFT sizes and convolution engines. </summary>
+/// <remarks> The cost of an FFT of size K is modeled as fft*K*log(K), that of adding or multiplying
+///		K samples as add*K and mul*K, and that of a direct convolution as mac per multiply-accumulate.
+///		Only the ratios matter, calibrated profiles are normalized to add=1. </remarks>
+struct TuningProfile {
+	double fft = 6.0;
+	double add = 1.0;
+	double mul = 3.0;
+	double mac = 2.0;
+};
+
+
+namespace impl {
+	inline std::mutex& TuningProfileMutex() {
+		static std::mutex mtx;
+		return mtx;
+	}
+
+	inline TuningProfile& GlobalTuningProfile() {
+		static TuningProfile profile;
+		return profile;
+	}
+
+	// Runs the operation repeatedly and returns the best time per call in seconds.
+	template <class Func>
+	double MeasureSeconds(Func func, size_t repetitions, size_t trials) {
+		using clock = std::chrono::steady_clock;
+		double best = std::numeric_limits<double>::max();
+		for (size_t trial = 0; trial < trials; ++trial) {
+			const auto start = clock::now();
+			for (size_t i = 0; i < repetitions; ++i) {
+				func();
+			}
+			const auto end = clock::now();
+			best = std::min(best, std::chrono::duration<double>(end - start).count() / double(repetitions));
+		}
+		return best;
+	}
+} // namespace impl
+
+
+/// <summary> Returns the profile currently used by the cost models. </summary>
+inline TuningProfile GetTuningProfile() {
+	std::lock_guard<std::mutex> lk(impl::TuningProfileMutex());
+	return impl::GlobalTuningProfile();
+}
+
+/// <summary> Replaces the profile used by the cost models for all subsequent calls. </summary>
+inline void SetTuningProfile(const TuningProfile& profile) {
+	if (!(profile.fft > 0.0 && profile.add > 0.0 && profile.mul > 0.0 && profile.mac > 0.0)) {
+		throw std::invalid_argument("Tuning constants must be positive.");
+	}
+	std::lock_guard<std::mutex> lk(impl::TuningProfileMutex());
+	impl::GlobalTuningProfile() = profile;
+}
+
+
+/// <summary> Fits the constants of the cost models by timing FFTs, additions, multiplications and direct convolution on this machine. </summary>
+/// <param name="maxFftSize"> The largest FFT size that is measured, sizes from 64 up are timed in powers of two. </param>
+/// <param name="trials"> The best of this many runs is kept for each measurement to filter out noise. </param>
+/// <typeparam name="T"> The sample type of the signals the profile will be used for. </typeparam>
+template <class T = float>
+TuningProfile CalibrateTuningProfile(size_t maxFftSize = 16384, size_t trials = 5) {
+	using complex_type = std::complex<remove_complex_t<T>>;
+	constexpr size_t minFftSize = 64;
+	constexpr size_t operationsPerSize = size_t(1) << 20;
+	assert(maxFftSize >= minFftSize);
+
+	double sumFft = 0.0;
+	double sumAdd = 0.0;
+	double sumMul = 0.0;
+	size_t count = 0;
+	for (size_t size = minFftSize; size <= maxFftSize; size *= 2) {
+		const size_t repetitions = std::max(size_t(1), operationsPerSize / size);
+		const size_t binCount = is_complex_v<T> ? size : size / 2 + 1;
+
+		FftPlan<T> plan{ size };
+		Signal<T> signal(size, T(1));
+		Signal<T> accumulator(size, T(0));
+		Spectrum<complex_type> spectrum(binCount, complex_type(1));
+		Spectrum<complex_type> filter(binCount, complex_type(1));
+		for (size_t i = 0; i < size; ++i) {
+			signal[i] = T(std::sin(double(i)));
+		}
+
+		const double tFft = impl::MeasureSeconds([&] { Fft(spectrum, signal, plan); }, repetitions, trials);
+		const double tMul = impl::MeasureSeconds([&] { Multiply(spectrum, spectrum, filter); }, repetitions, trials);
+		const double tAdd = impl::MeasureSeconds([&] { accumulator += signal; }, repetitions, trials);
+
+		sumFft += tFft / (double(size) * std::log(double(size)));
+		sumMul += tMul / double(size);
+		sumAdd += tAdd / double(size);
+		++count;
+	}
+
+	constexpr size_t convSignalSize = 4096;
+	constexpr size_t convFilterSize = 128;
+	Signal<T> convSignal(convSignalSize, T(1));
+	Signal<T> convFilter(convFilterSize, T(1));
+	Signal<T> convOut(ConvolutionLength(convSignalSize, convFilterSize, CONV_FULL));
+	const double tMac = impl::MeasureSeconds([&] { Convolution(convOut, convSignal, convFilter, CONV_FULL); }, 4, trials);
+
+	const double unit = sumAdd / double(count);
+	TuningProfile profile;
+	profile.fft = sumFft / double(count) / unit;
+	profile.add = 1.0;
+	profile.mul = sumMul / double(count) / unit;
+	profile.mac = tMac / double(convSignalSize * convFilterSize) / unit;
+	return profile;
+}
+
+
+/// <summary> Writes the profile as "key value" lines. </summary>
+inline void SaveTuningProfile(std::ostream& os, const TuningProfile& profile) {
+	const auto precision = os.precision(17);
+	os << "fft " << profile.fft << "\n";
+	os << "add " << profile.add << "\n";
+	os << "mul " << profile.mul << "\n";
+	os << "mac " << profile.mac << "\n";
+	os.precision(precision);
+}
+
+/// <summary> Reads a profile written by <see cref="SaveTuningProfile"/>. </summary>
+/// <remarks> Keys that are missing keep their default value, unknown keys are ignored. </remarks>
+inline TuningProfile LoadTuningProfile(std::istream& is) {
+	TuningProfile profile;
+	std::string line;
+	while (std::getline(is, line)) {
+		std::istringstream lineStream(line);
+		std::string key;
+		double value;
+		if (!(lineStream >> key) || key[0] == '#') {
+			continue;
+		}
+		if (!(lineStream >> value) || !(value > 0.0)) {
+			throw std::invalid_argument("Tuning profile contains an invalid value for \"" + key + "\".");
+		}
+		if (key == "fft") {
+			profile.fft = value;
+		}
+		else if (key == "add") {
+			profile.add = value;
+		}
+		else if (key == "mul") {
+			profile.mul = value;
+		}
+		else if (key == "mac") {
+			profile.mac = value;
+		}
+	}
+	return profile;
+}
+
+} // namespace dspbb
@@ -1318,9 +1318,15 @@ template<bool fwd, typename T> void passg (size_t ido, size_t ip,
 template<bool fwd, typename T> void pass_all(T c[], T0 fct) const
   {
   if (length==1) { c[0]*=fct; return; }
-  size_t l1=1;
   arr<T> ch(length);
-  T *p1=c, *p2=ch.data();
+  pass_all<fwd>(c, ch.data(), fct);
+  }
+
+template<bool fwd, typename T> void pass_all(T c[], T ch[], T0 fct) const
+  {
+  if (length==1) { c[0]*=fct; return; }
+  size_t l1=1;
+  T *p1=c, *p2=ch;
 
   for(size_t k1=0; k1<fact.size(); k1++)
     {
@@ -1366,6 +1372,9 @@ template<bool fwd, typename T> void pass_all(T c[], T0 fct) const
   public:
     template<typename T> void exec(T c[], T0 fct, bool fwd) const
       { fwd ? pass_all<true>(c, fct) : pass_all<false>(c, fct); }
+    /* Same as above, but uses the caller-supplied ch[length] as work area. */
+    template<typename T> void exec(T c[], T ch[], T0 fct, bool fwd) const
+      { fwd ? pass_all<true>(c, ch, fct) : pass_all<false>(c, ch, fct); }
 
   private:
     POCKETFFT_NOINLINE void factorize()
@@ -2121,11 +2130,18 @@ template<typename T> void radbg(size_t ido, size_t ip, size_t l1,
 
   public:
     template<typename T> void exec(T c[], T0 fct, bool r2hc) const
+      {
+      if (length==1) { c[0]*=fct; return; }
+      arr<T> ch(length);
+      exec(c, ch.data(), fct, r2hc);
+      }
+
+    /* Same as above, but uses the caller-supplied ch[length] as work area. */
+    template<typename T> void exec(T c[], T ch[], T0 fct, bool r2hc) const
       {
       if (length==1) { c[0]*=fct; return; }
       size_t n=length, nf=fact.size();
-      arr<T> ch(n);
-      T *p1=c, *p2=ch.data();
+      T *p1=c, *p2=ch;
 
       if (r2hc)
         for(size_t k1=0, l1=n; k1<nf;++k1)
@@ -2264,7 +2280,14 @@ template<typename T0> class fftblue
 
     template<bool fwd, typename T> void fft(cmplx<T> c[], T0 fct) const
       {
-      arr<cmplx<T>> akf(n2);
+      arr<cmplx<T>> buf(2*n2);
+      fft<fwd>(c, buf.data(), fct);
+      }
+
+    /* buf must hold 2*n2 elements: a_k followed by the work area of the inner plan. */
+    template<bool fwd, typename T> void fft(cmplx<T> c[], cmplx<T> buf[], T0 fct) const
+      {
+      cmplx<T> *akf = buf, *ch = buf+n2;
 
       /* initialize a_k and FFT it */
       for (size_t m=0; m<n; ++m)
@@ -2273,7 +2296,7 @@ template<typename T0> class fftblue
       for (size_t m=n; m<n2; ++m)
         akf[m]=zero;
 
-      plan.exec (akf.data(),1.,true);
+      plan.exec (akf,ch,1.,true);
 
       /* do the convolution */
       akf[0] = akf[0].template special_mul<!fwd>(bkf[0]);
@@ -2286,7 +2309,7 @@ template<typename T0> class fftblue
         akf[n2/2] = akf[n2/2].template special_mul<!fwd>(bkf[n2/2]);
 
       /* inverse FFT */
-      plan.exec (akf.data(),1.,false);
+      plan.exec (akf,ch,1.,false);
 
       /* multiply by b_k */
       for (size_t m=0; m<n; ++m)
@@ -2326,27 +2349,41 @@ template<typename T0> class fftblue
     template<typename T> void exec(cmplx<T> c[], T0 fct, bool fwd) const
       { fwd ? fft<true>(c,fct) : fft<false>(c,fct); }
 
+    /* Same as above, but buf must hold scratch_size() elements. */
+    template<typename T> void exec(cmplx<T> c[], cmplx<T> buf[], T0 fct, bool fwd) const
+      { fwd ? fft<true>(c,buf,fct) : fft<false>(c,buf,fct); }
+
+    size_t scratch_size() const { return 2*n2; }
+    size_t scratch_size_r() const { return n+2*n2; }
+
     template<typename T> void exec_r(T c[], T0 fct, bool fwd)
       {
-      arr<cmplx<T>> tmp(n);
+      arr<cmplx<T>> buf(scratch_size_r());
+      exec_r(c, buf.data(), fct, fwd);
+      }
+
+    /* Same as above, but buf must hold scratch_size_r() elements. */
+    template<typename T> void exec_r(T c[], cmplx<T> buf[], T0 fct, bool fwd)
+      {
+      cmplx<T> *tmp = buf, *fftbuf = buf+n;
       if (fwd)
         {
         auto zero = T0(0)*c[0];
         for (size_t m=0; m<n; ++m)
           tmp[m].Set(c[m], zero);
-        fft<true>(tmp.data(),fct);
+        fft<true>(tmp,fftbuf,fct);
         c[0] = tmp[0].r;
-        memcpy (c+1, tmp.data()+1, (n-1)*sizeof(T));
+        memcpy (c+1, tmp+1, (n-1)*sizeof(T));
         }
       else
         {
         tmp[0].Set(c[0],c[0]*0);
-        memcpy (reinterpret_cast<void *>(tmp.data()+1),
+        memcpy (reinterpret_cast<void *>(tmp+1),
                 reinterpret_cast<void *>(c+1), (n-1)*sizeof(T));
         if ((n&1)==0) tmp[n/2].i=T0(0)*c[0];
         for (size_t m=1; 2*m<n; ++m)
           tmp[n-m].Set(tmp[m].r, -tmp[m].i);
-        fft<false>(tmp.data(),fct);
+        fft<false>(tmp,fftbuf,fct);
         for (size_t m=0; m<n; ++m)
           c[m] = tmp[m].r;
         }
@@ -2387,7 +2424,12 @@ template<typename T0> class pocketfft_c
     template<typename T> POCKETFFT_NOINLINE void exec(cmplx<T> c[], T0 fct, bool fwd) const
       { packplan ? packplan->exec(c,fct,fwd) : blueplan->exec(c,fct,fwd); }
 
+    /* Allocation-free variant, buf must hold scratch_size() elements. */
+    template<typename T> POCKETFFT_NOINLINE void exec(cmplx<T> c[], cmplx<T> buf[], T0 fct, bool fwd) const
+      { packplan ? packplan->exec(c,buf,fct,fwd) : blueplan->exec(c,buf,fct,fwd); }
+
     size_t length() const { return len; }
+    size_t scratch_size() const { return packplan ? len : blueplan->scratch_size(); }
   };
 
 //
@@ -2424,7 +2466,12 @@ template<typename T0> class pocketfft_r
     template<typename T> POCKETFFT_NOINLINE void exec(T c[], T0 fct, bool fwd) const
       { packplan ? packplan->exec(c,fct,fwd) : blueplan->exec_r(c,fct,fwd); }
 
+    /* Allocation-free variant, buf must hold scratch_size() elements. */
+    template<typename T> POCKETFFT_NOINLINE void exec(T c[], T buf[], T0 fct, bool fwd) const
+      { packplan ? packplan->exec(c,buf,fct,fwd) : blueplan->exec_r(c,reinterpret_cast<cmplx<T> *>(buf),fct,fwd); }
+
     size_t length() const { return len; }
+    size_t scratch_size() const { return packplan ? len : 2*blueplan->scratch_size_r(); }
   };
 
 
@@ -3461,6 +3508,9 @@ using detail::FORWARD;
 using detail::BACKWARD;
 using detail::shape_t;
 using detail::stride_t;
+using detail::cmplx;
+using detail::pocketfft_c;
+using detail::pocketfft_r;
 using detail::c2c;
 using detail::c2r;
 using detail::r2c;
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+#if defined(__linux__)
+	#include <unistd.h>
+#endif
+
+
+namespace dspbb {
+
+/// <summary> The data cache sizes of a single core in bytes, used to pick tile sizes for cache-blocked algorithms. </summary>
+struct CacheSizes {
+	size_t l1 = 32768;
+	size_t l2 = 262144;
+};
+
+
+/// <summary> Queries the cache sizes from the operating system. </summary>
+/// <remarks> Sizes that the system does not report are left at their defaults. Only Linux is queried at the moment. </remarks>
+inline CacheSizes DetectCacheSizes() {
+	CacheSizes sizes;
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+	const long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+	const long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+	if (l1 > 0) {
+		sizes.l1 = size_t(l1);
+	}
+	if (l2 > 0) {
+		sizes.l2 = size_t(l2);
+	}
+#endif
+	return sizes;
+}
+
+
+namespace impl {
+	// The sizes are read on every convolution, so they are kept in atomics rather than behind a lock.
+	// A reader racing with SetCacheSizes may see one old and one new size, which only affects the tiling.
+	struct GlobalCacheSizes {
+		std::atomic<size_t> l1;
+		std::atomic<size_t> l2;
+
+		static GlobalCacheSizes& Get() {
+			static GlobalCacheSizes sizes{ DetectCacheSizes() };
+			return sizes;
+		}
+
+	private:
+		explicit GlobalCacheSizes(const CacheSizes& sizes) : l1(sizes.l1), l2(sizes.l2) {}
+	};
+} // namespace impl
+
+
+/// <summary> Returns the cache sizes currently used to pick tile sizes. They are detected on first use. </summary>
+inline CacheSizes GetCacheSizes() {
+	const auto& global = impl::GlobalCacheSizes::Get();
+	return { global.l1.load(std::memory_order_relaxed), global.l2.load(std::memory_order_relaxed) };
+}
+
+/// <summary> Replaces the cache sizes used to pick tile sizes for all subsequent calls. </summary>
+inline void SetCacheSizes(const CacheSizes& sizes) {
+	if (sizes.l1 == 0 || sizes.l2 == 0) {
+		throw std::invalid_argument("Cache sizes must be positive.");
+	}
+	auto& global = impl::GlobalCacheSizes::Get();
+	global.l1.store(sizes.l1, std::memory_order_relaxed);
+	global.l2.store(sizes.l2, std::memory_order_relaxed);
+}
+
+} // namespace dspbb
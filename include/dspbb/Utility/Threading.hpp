@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+
+namespace dspbb {
+
+/// <summary> Requests that an algorithm spreads its work over multiple threads. </summary>
+struct ParallelExecution {
+	/// <summary> The number of threads to use, 0 means all hardware threads. </summary>
+	size_t numThreads = 0;
+};
+
+
+namespace impl {
+	// A process-wide pool of worker threads. It is created on first use, and threads are only started when
+	// a call needs more than the pool already has. The calling thread takes part in its own call, and while it
+	// waits, it runs any queued tasks, so nested calls from inside a task cannot deadlock.
+	class ThreadPool {
+	public:
+		static ThreadPool& Get() {
+			static ThreadPool pool;
+			return pool;
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		~ThreadPool();
+
+		// Calls func(index) for every index in [0, count) and returns when all calls have finished.
+		// The first exception thrown by a call is rethrown once all have finished.
+		template <class Func>
+		void Run(size_t count, Func& func);
+
+	private:
+		struct Job {
+			std::function<void(size_t)> func;
+			size_t count = 0;
+			size_t next = 0;
+			size_t unfinished = 0;
+			std::exception_ptr exception;
+		};
+
+		ThreadPool() = default;
+		void WorkerMain();
+		bool RunOne(std::unique_lock<std::mutex>& lock, Job* preferred);
+		void AddThreads(size_t numThreads);
+
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_changed;
+		std::deque<Job*> m_jobs;
+		std::vector<std::thread> m_threads;
+		bool m_stop = false;
+	};
+
+
+	inline ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard lock(m_mutex);
+			m_stop = true;
+		}
+		m_changed.notify_all();
+		for (auto& thread : m_threads) {
+			thread.join();
+		}
+	}
+
+	template <class Func>
+	void ThreadPool::Run(size_t count, Func& func) {
+		Job job;
+		job.func = [&func](size_t index) { func(index); };
+		job.count = count;
+		job.unfinished = count;
+
+		std::unique_lock lock(m_mutex);
+		AddThreads(count - 1);
+		m_jobs.push_back(&job);
+		m_changed.notify_all();
+		while (job.unfinished > 0) {
+			if (!RunOne(lock, &job)) {
+				m_changed.wait(lock);
+			}
+		}
+		lock.unlock();
+		if (job.exception) {
+			std::rethrow_exception(job.exception);
+		}
+	}
+
+	inline void ThreadPool::WorkerMain() {
+		std::unique_lock lock(m_mutex);
+		while (!m_stop) {
+			if (!RunOne(lock, nullptr)) {
+				m_changed.wait(lock);
+			}
+		}
+	}
+
+	// Runs one queued call, from the preferred job if it has any left. The lock is held on entry and on return.
+	inline bool ThreadPool::RunOne(std::unique_lock<std::mutex>& lock, Job* preferred) {
+		if (m_jobs.empty()) {
+			return false;
+		}
+		Job& job = preferred && preferred->next < preferred->count ? *preferred : *m_jobs.front();
+		const size_t index = job.next++;
+		if (job.next == job.count) {
+			m_jobs.erase(std::find(m_jobs.begin(), m_jobs.end(), &job));
+		}
+
+		lock.unlock();
+		std::exception_ptr exception;
+		try {
+			job.func(index);
+		}
+		catch (...) {
+			exception = std::current_exception();
+		}
+		lock.lock();
+
+		if (exception && !job.exception) {
+			job.exception = exception;
+		}
+		if (--job.unfinished == 0) {
+			m_changed.notify_all();
+		}
+		return true;
+	}
+
+	// Must be called with the lock held. If the system refuses to start more threads, the pool keeps the ones
+	// it has: the calling thread runs whatever the workers do not pick up, so the results are the same.
+	inline void ThreadPool::AddThreads(size_t numThreads) {
+		while (m_threads.size() < numThreads) {
+			try {
+				m_threads.emplace_back([this] { WorkerMain(); });
+			}
+			catch (const std::system_error&) {
+				break;
+			}
+		}
+	}
+
+
+	// Splits [0, count) into contiguous ranges and calls func(first, last, workerIndex) for each on the thread pool.
+	// The first exception thrown by any worker is rethrown once all have finished.
+	template <class Func>
+	void ParallelRanges(size_t count, size_t numWorkers, Func func) {
+		if (numWorkers <= 1) {
+			func(size_t(0), count, size_t(0));
+			return;
+		}
+		auto range = [&](size_t worker) {
+			func(count * worker / numWorkers, count * (worker + 1) / numWorkers, worker);
+		};
+		ThreadPool::Get().Run(numWorkers, range);
+	}
+
+	inline size_t BatchWorkerCount(size_t numTasks, size_t numThreads) {
+		const size_t maxThreads = numThreads == 0 ? size_t(std::thread::hardware_concurrency()) : numThreads;
+		return std::max(size_t(1), std::min(numTasks, maxThreads));
+	}
+} // namespace impl
+
+} // namespace dspbb
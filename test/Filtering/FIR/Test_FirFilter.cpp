@@ -0,0 +1,60 @@
+#include "../../TestUtils.hpp"
+
+#include <dspbb/Filtering/FIR/FirFilter.hpp>
+#include <dspbb/Math/Convolution.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+TEST_CASE("FIR filter - Real blocks", "[FirFilter]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(500);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(37);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+	const std::array<size_t, 6> blockSizes = { 1, 7, 36, 37, 64, 500 };
+
+	for (auto blockSize : blockSizes) {
+		FirFilter<float> fir{ filter, 64 };
+		REQUIRE(fir.capacity() == 64);
+		const auto out = ProcessInBlocks(fir, signal, blockSize);
+		REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.0001f));
+	}
+}
+
+TEST_CASE("FIR filter - Complex blocks", "[FirFilter]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(500);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(20);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+
+	FirFilter<std::complex<float>> fir{ filter };
+	const auto out = ProcessInBlocks(fir, signal, 50);
+	REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.0001f));
+}
+
+TEST_CASE("FIR filter - Single tap", "[FirFilter]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(100);
+	const Signal<float> filter = { 2.0f };
+
+	FirFilter<float> fir{ filter, 16 };
+	const auto out = ProcessInBlocks(fir, signal, 3);
+	REQUIRE(Max(Abs(out - 2.0f * signal)) == 0.0f);
+}
+
+TEST_CASE("FIR filter - Reset", "[FirFilter]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(100);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(16);
+
+	FirFilter<float> fir{ filter, 40 };
+	const auto first = ProcessInBlocks(fir, signal, 30);
+	fir.reset();
+	const auto second = ProcessInBlocks(fir, signal, 30);
+	REQUIRE(Max(Abs(first - second)) == 0.0f);
+}
@@ -0,0 +1,176 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Filtering/Cic.hpp>
+#include <dspbb/Filtering/Resample.hpp>
+#include <dspbb/Math/Convolution.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <complex>
+#include <random>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+static Signal<double> CicImpulseResponse(size_t order, size_t delay, size_t rate) {
+	const Signal<double> boxcar(rate * delay, 1.0);
+	Signal<double> response = { 1.0 };
+	for (size_t stage = 0; stage < order; ++stage) {
+		response = Convolution(response, boxcar, CONV_FULL);
+	}
+	return response;
+}
+
+static Signal<int> RandomIntegerSignal(size_t length, int amplitude) {
+	thread_local std::mt19937 rne(1234);
+	std::uniform_int_distribution<int> rng(-amplitude, amplitude);
+	Signal<int> signal(length);
+	for (auto& v : signal) {
+		v = rng(rne);
+	}
+	return signal;
+}
+
+
+TEST_CASE("CIC parameters", "[CIC]") {
+	REQUIRE_THROWS(CicDecimator<float>(0, 1, 8));
+	REQUIRE_THROWS(CicDecimator<float>(3, 0, 8));
+	REQUIRE_THROWS(CicInterpolator<float>(3, 1, 0));
+	REQUIRE_THROWS(CicDecimator<float, int32_t>(8, 1, 1024));
+	REQUIRE_NOTHROW(CicDecimator<float, int16_t>(4, 2, 1024));
+	REQUIRE_NOTHROW(CicDecimator<float, int32_t>(4, 1, 256));
+	REQUIRE_THROWS(CicDecimator<float, uint32_t>(4, 1, 256));
+	REQUIRE_THROWS(CicDecimator<float, uint64_t>(1, 1, 1));
+
+	const CicDecimator<float> decimator{ 3, 2, 16 };
+	REQUIRE(decimator.order() == 3);
+	REQUIRE(decimator.delay() == 2);
+	REQUIRE(decimator.rate() == 16);
+	REQUIRE(decimator.outputSize(0) == 0);
+	REQUIRE(decimator.outputSize(1) == 1);
+	REQUIRE(decimator.outputSize(16) == 1);
+	REQUIRE(decimator.outputSize(17) == 2);
+}
+
+
+TEST_CASE("CIC unsigned input at the register limit", "[CIC]") {
+	// 32 input bits, a sign bit and 31 bits of growth fill the 64 bit registers exactly.
+	constexpr size_t order = 31;
+	constexpr size_t rate = 2;
+	const Signal<uint32_t> signal(256, std::numeric_limits<uint32_t>::max());
+
+	CicDecimator<double, uint32_t> decimator{ order, 1, rate };
+	Signal<double> result(decimator.outputSize(signal.size()));
+	decimator.process(result, signal);
+	const auto settled = AsConstView(result).subsignal(order);
+	REQUIRE(Min(settled) == double(std::numeric_limits<uint32_t>::max()));
+	REQUIRE(Max(settled) == double(std::numeric_limits<uint32_t>::max()));
+}
+
+
+TEST_CASE("CIC decimator", "[CIC]") {
+	constexpr size_t order = 3;
+	constexpr size_t delay = 2;
+	constexpr size_t rate = 8;
+	const auto signal = RandomIntegerSignal(400, 1000);
+	const Signal<double> signalReal(signal.begin(), signal.end());
+	const auto filtered = Convolution(signalReal, CicImpulseResponse(order, delay, rate), 0, signal.size());
+	const auto expected = Decimate(filtered, rate) / std::pow(double(rate * delay), double(order));
+
+	CicDecimator<double> decimator{ order, delay, rate };
+	Signal<double> result;
+	size_t first = 0;
+	for (const size_t blockSize : { 1, 5, 13, 100, 281 }) {
+		Signal<double> block(decimator.outputSize(blockSize));
+		decimator.process(block, AsConstView(signal).subsignal(first, blockSize));
+		result.insert(result.end(), block.begin(), block.end());
+		first += blockSize;
+	}
+
+	REQUIRE(result.size() == expected.size());
+	REQUIRE(Max(Abs(result - expected)) < 1e-9);
+}
+
+
+TEST_CASE("CIC interpolator", "[CIC]") {
+	constexpr size_t order = 4;
+	constexpr size_t delay = 1;
+	constexpr size_t rate = 5;
+	const auto signal = RandomIntegerSignal(100, 1000);
+	const Signal<double> signalReal(signal.begin(), signal.end());
+	const auto expanded = Expand(signalReal, rate);
+	const auto expected = Convolution(expanded, CicImpulseResponse(order, delay, rate), 0, expanded.size()) * (double(rate) / std::pow(double(rate * delay), double(order)));
+
+	CicInterpolator<double> interpolator{ order, delay, rate };
+	Signal<double> result(signal.size() * rate);
+	size_t first = 0;
+	for (const size_t blockSize : { 1, 7, 30, 62 }) {
+		interpolator.process(AsView(result).subsignal(first * rate, blockSize * rate), AsConstView(signal).subsignal(first, blockSize));
+		first += blockSize;
+	}
+
+	REQUIRE(Max(Abs(result - expected)) < 1e-9);
+}
+
+
+TEST_CASE("CIC wraparound", "[CIC]") {
+	constexpr int32_t value = std::numeric_limits<int32_t>::max();
+	const Signal<int32_t> signal(64 * 64, value);
+
+	CicDecimator<double, int32_t> decimator{ 4, 1, 64 };
+	Signal<double> result(decimator.outputSize(signal.size()));
+	decimator.process(result, signal);
+
+	// The integrators wrap around within a few samples, the settled output is still exact.
+	for (size_t i = 4; i < result.size(); ++i) {
+		REQUIRE(result[i] == double(value));
+	}
+
+	CicDecimator<double, int32_t> negative{ 4, 1, 64 };
+	const Signal<int32_t> negativeSignal(64 * 64, std::numeric_limits<int32_t>::min());
+	negative.process(result, negativeSignal);
+	REQUIRE(result[result.size() - 1] == double(std::numeric_limits<int32_t>::min()));
+}
+
+
+TEST_CASE("CIC reset", "[CIC]") {
+	const auto signal = RandomIntegerSignal(100, 1000);
+	CicDecimator<float> decimator{ 3, 1, 4 };
+	CicInterpolator<float> interpolator{ 3, 1, 4 };
+
+	Signal<float> decimated1(25), decimated2(25);
+	Signal<float> interpolated1(400), interpolated2(400);
+	decimator.process(decimated1, AsConstView(signal).subsignal(0, 99));
+	decimator.reset();
+	decimator.process(decimated2, AsConstView(signal).subsignal(0, 99));
+	interpolator.process(interpolated1, signal);
+	interpolator.reset();
+	interpolator.process(interpolated2, signal);
+
+	REQUIRE(Max(Abs(decimated1 - decimated2)) == 0.0f);
+	REQUIRE(Max(Abs(interpolated1 - interpolated2)) == 0.0f);
+}
+
+
+TEST_CASE("CIC compensator", "[CIC]") {
+	constexpr size_t order = 4;
+	constexpr size_t delay = 1;
+	constexpr size_t rate = 32;
+	constexpr float cutoff = 0.4f;
+	const auto compensator = DesignCicCompensator<double, TIME_DOMAIN>(31, order, delay, rate, cutoff);
+
+	for (double frequency = 0.0; frequency <= 0.8 * cutoff; frequency += 0.05) {
+		std::complex<double> compensatorResponse = 0.0;
+		for (size_t k = 0; k < compensator.size(); ++k) {
+			compensatorResponse += compensator[k] * std::polar(1.0, -pi_v<double> * frequency * double(k));
+		}
+		const double combined = std::abs(compensatorResponse) * CicResponse(frequency, order, delay, rate);
+		INFO("frequency=" << frequency);
+		REQUIRE(combined == Approx(1.0).margin(0.02));
+	}
+	REQUIRE(CicResponse(0.5, order, delay, rate) < 1.0);
+}
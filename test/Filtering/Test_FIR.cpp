@@ -45,6 +45,13 @@ TEST_CASE("Filter state continuity", "[FIR]") {
 			Filter(AsView(result).subsignal(i, step), AsView(signal).subsignal(i, step), filter, state, FILTER_OLA);
 		}
 	}
+	SECTION("OLS large") {
+		constexpr int step = 40;
+		static_assert(length % step == 0);
+		for (size_t i = 0; i < length; i += step) {
+			Filter(AsView(result).subsignal(i, step), AsView(signal).subsignal(i, step), filter, state, FILTER_OLS);
+		}
+	}
 	SECTION("Convolution small") {
 		constexpr int step = 4;
 		static_assert(length % step == 0);
@@ -59,6 +66,20 @@ TEST_CASE("Filter state continuity", "[FIR]") {
 			Filter(AsView(result).subsignal(i, step), AsView(signal).subsignal(i, step), filter, state, FILTER_OLA);
 		}
 	}
+	SECTION("OLS small") {
+		constexpr int step = 4;
+		static_assert(length % step == 0);
+		for (size_t i = 0; i < length; i += step) {
+			Filter(AsView(result).subsignal(i, step), AsView(signal).subsignal(i, step), filter, state, FILTER_OLS);
+		}
+	}
+	SECTION("Auto small") {
+		constexpr int step = 4;
+		static_assert(length % step == 0);
+		for (size_t i = 0; i < length; i += step) {
+			Filter(AsView(result).subsignal(i, step), AsView(signal).subsignal(i, step), filter, state, FILTER_AUTO);
+		}
+	}
 	SECTION("Convolution copy") {
 		constexpr int step = 4;
 		static_assert(length % step == 0);
@@ -77,6 +98,24 @@ TEST_CASE("Filter state continuity", "[FIR]") {
 			std::copy(batch.begin(), batch.end(), outBatch.begin());
 		}
 	}
+	SECTION("OLS copy") {
+		constexpr int step = 4;
+		static_assert(length % step == 0);
+		for (size_t i = 0; i < length; i += step) {
+			const auto batch = Filter(AsView(signal).subsignal(i, step), filter, state, FILTER_OLS);
+			const auto outBatch = AsView(result).subsignal(i, step);
+			std::copy(batch.begin(), batch.end(), outBatch.begin());
+		}
+	}
+	SECTION("Auto copy") {
+		constexpr int step = 40;
+		static_assert(length % step == 0);
+		for (size_t i = 0; i < length; i += step) {
+			const auto batch = Filter(AsView(signal).subsignal(i, step), filter, state, FILTER_AUTO);
+			const auto outBatch = AsView(result).subsignal(i, step);
+			std::copy(batch.begin(), batch.end(), outBatch.begin());
+		}
+	}
 
 	REQUIRE(Max(Abs(result - expected)) < 1e-7);
 }
@@ -98,6 +137,14 @@ TEST_CASE("Filter central", "[FIR]") {
 		const auto result = Filter(signal, filter, CONV_CENTRAL, FILTER_OLA);
 		REQUIRE(Max(Abs(result - expected)) < 1e-7);
 	}
+	SECTION("OLS") {
+		const auto result = Filter(signal, filter, CONV_CENTRAL, FILTER_OLS);
+		REQUIRE(Max(Abs(result - expected)) < 1e-7);
+	}
+	SECTION("Auto") {
+		const auto result = Filter(signal, filter, CONV_CENTRAL, FILTER_AUTO);
+		REQUIRE(Max(Abs(result - expected)) < 1e-7);
+	}
 }
 
 TEST_CASE("Filter full", "[FIR]") {
@@ -118,6 +165,115 @@ TEST_CASE("Filter full", "[FIR]") {
 		const auto result = Filter(signal, filter, CONV_FULL, FILTER_OLA);
 		REQUIRE(Max(Abs(result - expected)) < 1e-7);
 	}
+	SECTION("OLS") {
+		const auto result = Filter(signal, filter, CONV_FULL, FILTER_OLS);
+		REQUIRE(Max(Abs(result - expected)) < 1e-7);
+	}
+	SECTION("Auto") {
+		const auto result = Filter(signal, filter, CONV_FULL, FILTER_AUTO);
+		REQUIRE(Max(Abs(result - expected)) < 1e-7);
+	}
+	SECTION("OLA parallel") {
+		Signal<double> result(expected.size());
+		Filter(result, signal, filter, CONV_FULL, FILTER_OLA, ParallelExecution{ 2 }, 16);
+		REQUIRE(Max(Abs(result - expected)) < 1e-7);
+	}
+	SECTION("Convolution parallel") {
+		Signal<double> result(expected.size());
+		Filter(result, signal, filter, CONV_FULL, FILTER_CONV, ParallelExecution{ 2 });
+		REQUIRE(Max(Abs(result - expected)) < 1e-7);
+	}
+}
+
+TEST_CASE("Filter auto dispatch", "[FIR]") {
+	const auto original = GetTuningProfile();
+	const ScopeExit restore{ [original] { SetTuningProfile(original); } };
+
+	REQUIRE(!impl::PreferOverlapAdd(262144, 8, 262144 * 8));
+	REQUIRE(impl::PreferOverlapAdd(262144, 4096, 262144 * 4096));
+
+	TuningProfile cheapMac = original;
+	cheapMac.mac = 1e-6;
+	SetTuningProfile(cheapMac);
+	REQUIRE(!impl::PreferOverlapAdd(262144, 4096, 262144 * 4096));
+
+	TuningProfile expensiveMac = original;
+	expensiveMac.mac = 1e6;
+	SetTuningProfile(expensiveMac);
+	REQUIRE(impl::PreferOverlapAdd(262144, 8, 262144 * 8));
+}
+
+TEST_CASE("Filter linear phase", "[FIR]") {
+	constexpr int length = 80;
+
+	const auto signal = RandomSignal<double, TIME_DOMAIN>(length);
+	const auto lowpass = DesignFilter<double, TIME_DOMAIN>(33, Fir.Lowpass.Windowed.Cutoff(0.3f));
+	const auto hilbert = DesignFilter<double, TIME_DOMAIN>(32, Fir.Hilbert.Windowed);
+
+	SECTION("Detect symmetry") {
+		REQUIRE(DetectSymmetry(lowpass, 1e-12) == eSymmetry::SYMMETRIC);
+		REQUIRE(DetectSymmetry(hilbert, 1e-12) == eSymmetry::ANTISYMMETRIC);
+		REQUIRE(!DetectSymmetry(Signal<double>{ 1, 2, 3 }));
+		REQUIRE_THROWS_AS(LinearPhaseFilter<double>(Signal<double>{ 1, 2, 3 }), std::invalid_argument);
+	}
+	SECTION("Impulse response") {
+		const LinearPhaseFilter<double> filter{ AsConstView(hilbert).subsignal(0, 16), hilbert.size(), eSymmetry::ANTISYMMETRIC };
+		REQUIRE(Max(Abs(filter.impulseResponse() - hilbert)) < 1e-12);
+	}
+	SECTION("Antisymmetric center tap") {
+		REQUIRE_THROWS_AS(LinearPhaseFilter<double>(Signal<double>{ 1, 2 }, 3, eSymmetry::ANTISYMMETRIC), std::invalid_argument);
+		REQUIRE_NOTHROW(LinearPhaseFilter<double>(Signal<double>{ 1, 2 }, 3, eSymmetry::SYMMETRIC));
+		const LinearPhaseFilter<double> filter{ Signal<double>{ 1, 0 }, 3, eSymmetry::ANTISYMMETRIC };
+		REQUIRE(Max(Abs(filter.impulseResponse() - Signal<double>{ 1, 0, -1 })) == 0.0);
+
+		const LinearPhaseFilter<double> detected{ Signal<double>{ 1, 1e-20, -1 }, 1e-12 };
+		REQUIRE(detected.symmetry() == eSymmetry::ANTISYMMETRIC);
+		REQUIRE(detected.halfKernel()[1] == 0.0);
+	}
+	SECTION("Central") {
+		const LinearPhaseFilter<double> filter{ lowpass };
+		const auto result = Filter(signal, filter, CONV_CENTRAL);
+		REQUIRE(Max(Abs(result - Convolution(signal, lowpass, CONV_CENTRAL))) < 1e-7);
+	}
+	SECTION("Full") {
+		const LinearPhaseFilter<double> filter{ hilbert };
+		const auto result = Filter(signal, filter, CONV_FULL);
+		REQUIRE(Max(Abs(result - Convolution(signal, hilbert, CONV_FULL))) < 1e-7);
+	}
+	SECTION("State") {
+		const LinearPhaseFilter<double> filter{ lowpass };
+		Signal<double> state(lowpass.size() - 1, 0.0);
+		Signal<double> result(length);
+		for (size_t i = 0; i < length; i += 10) {
+			Filter(AsView(result).subsignal(i, 10), AsView(signal).subsignal(i, 10), filter, state);
+		}
+		REQUIRE(Max(Abs(result - Convolution(signal, lowpass, 0, length))) < 1e-7);
+	}
+}
+
+TEST_CASE("Filter fixed length", "[FIR]") {
+	constexpr int length = 80;
+
+	const auto signal = RandomSignal<double, TIME_DOMAIN>(length);
+	const auto taps = DesignFilter<double, TIME_DOMAIN>(7, Fir.Lowpass.LeastSquares.Cutoff(0.3f, 0.33f));
+	const FixedFir<double, 7> filter{ taps };
+
+	SECTION("Central") {
+		const auto result = Filter(signal, filter, CONV_CENTRAL);
+		REQUIRE(Max(Abs(result - Convolution(signal, taps, CONV_CENTRAL))) < 1e-7);
+	}
+	SECTION("Full") {
+		const auto result = Filter(signal, filter, CONV_FULL);
+		REQUIRE(Max(Abs(result - Convolution(signal, taps, CONV_FULL))) < 1e-7);
+	}
+	SECTION("State") {
+		Signal<double> state(taps.size() - 1, 0.0);
+		Signal<double> result(length);
+		for (size_t i = 0; i < length; i += 4) {
+			Filter(AsView(result).subsignal(i, 4), AsView(signal).subsignal(i, 4), filter, state);
+		}
+		REQUIRE(Max(Abs(result - Convolution(signal, taps, 0, length))) < 1e-7);
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,107 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Filtering/FIR.hpp>
+#include <dspbb/Filtering/Halfband.hpp>
+#include <dspbb/Filtering/Resample.hpp>
+#include <dspbb/Math/Convolution.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+static Signal<float> HalfbandLowpass(size_t size) {
+	return DesignFilter<float, TIME_DOMAIN>(size, Fir.Lowpass.Windowed.Cutoff(0.5f));
+}
+
+
+TEST_CASE("Halfband taps", "[Halfband]") {
+	SECTION("Odd center") {
+		const auto filter = HalfbandLowpass(11);
+		const HalfbandDecimator<float> decimator{ filter };
+		REQUIRE(decimator.filterSize() == 11);
+		REQUIRE(decimator.denseTaps().size() == 6);
+		REQUIRE(decimator.denseTaps()[1] == filter[2]);
+		REQUIRE(decimator.centerTap() == filter[5]);
+	}
+	SECTION("Even center") {
+		const auto filter = HalfbandLowpass(9);
+		const HalfbandInterpolator<float> interpolator{ filter };
+		REQUIRE(interpolator.filterSize() == 9);
+		REQUIRE(interpolator.denseTaps().size() == 4);
+		REQUIRE(interpolator.denseTaps()[1] == filter[3]);
+		REQUIRE(interpolator.centerTap() == filter[4]);
+	}
+	SECTION("Not halfband") {
+		REQUIRE_THROWS(HalfbandDecimator<float>{ RandomSignal<float, TIME_DOMAIN>(11) });
+		REQUIRE_THROWS(HalfbandInterpolator<float>{ AsConstView(HalfbandLowpass(11)).subsignal(0, 10) });
+	}
+}
+
+
+TEST_CASE("Halfband decimator", "[Halfband]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(240);
+
+	for (const size_t filterSize : { 3, 9, 11, 31 }) {
+		const auto filter = HalfbandLowpass(filterSize);
+		const auto expected = Decimate(Convolution(signal, filter, 0, signal.size()), 2);
+
+		HalfbandDecimator<float> decimator{ filter, 16 };
+		Signal<float> result(signal.size() / 2);
+		size_t first = 0;
+		for (const size_t blockSize : { 2, 10, 64, 164 }) {
+			decimator.process(AsView(result).subsignal(first / 2, blockSize / 2), AsConstView(signal).subsignal(first, blockSize));
+			first += blockSize;
+		}
+
+		INFO("filterSize=" << filterSize);
+		REQUIRE(Max(Abs(result - expected)) < 1e-5f);
+	}
+}
+
+
+TEST_CASE("Halfband interpolator", "[Halfband]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(120);
+
+	for (const size_t filterSize : { 3, 9, 11, 31 }) {
+		const auto filter = HalfbandLowpass(filterSize);
+		const auto expected = Convolution(Expand(signal, 2), filter, 0, 2 * signal.size()) * 2.0f;
+
+		HalfbandInterpolator<float> interpolator{ filter, 16 };
+		Signal<float> result(2 * signal.size());
+		size_t first = 0;
+		for (const size_t blockSize : { 1, 5, 32, 82 }) {
+			interpolator.process(AsView(result).subsignal(2 * first, 2 * blockSize), AsConstView(signal).subsignal(first, blockSize));
+			first += blockSize;
+		}
+
+		INFO("filterSize=" << filterSize);
+		REQUIRE(Max(Abs(result - expected)) < 1e-5f);
+	}
+}
+
+
+TEST_CASE("Halfband reset", "[Halfband]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(64);
+	const auto filter = HalfbandLowpass(11);
+
+	HalfbandDecimator<float> decimator{ filter };
+	HalfbandInterpolator<float> interpolator{ filter };
+	Signal<float> decimated1(32), decimated2(32);
+	Signal<float> interpolated1(128), interpolated2(128);
+
+	decimator.process(decimated1, signal);
+	interpolator.process(interpolated1, signal);
+	decimator.reset();
+	interpolator.reset();
+	decimator.process(decimated2, signal);
+	interpolator.process(interpolated2, signal);
+
+	REQUIRE(Max(Abs(decimated1 - decimated2)) == 0.0f);
+	REQUIRE(Max(Abs(interpolated1 - interpolated2)) == 0.0f);
+}
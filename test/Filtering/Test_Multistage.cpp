@@ -0,0 +1,135 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Filtering/Multistage.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <functional>
+#include <numeric>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+// A sine wave at the given frequency, normalized to the Nyquist frequency, sampled starting from first.
+static Signal<float> Sine(size_t length, double frequency, double first = 0.0) {
+	Signal<float> signal(length);
+	for (size_t i = 0; i < length; ++i) {
+		signal[i] = float(std::sin(pi_v<double> * frequency * (double(i) + first)));
+	}
+	return signal;
+}
+
+
+TEST_CASE("Multistage plan", "[Multistage]") {
+	constexpr size_t ratio = 40;
+	const auto plan = PlanMultistage(ratio, 0.8f, 80.0f);
+
+	REQUIRE(plan.ratio == ratio);
+	REQUIRE(plan.rates.size() > 1);
+	REQUIRE(plan.rates.size() == plan.filterSizes.size());
+	REQUIRE(std::accumulate(plan.rates.begin(), plan.rates.end(), size_t(1), std::multiplies<>{}) == ratio);
+
+	// A single stage needs the narrow final transition band at the high rate.
+	const auto single = impl::EstimateMultistageFilterSize(0.2 / double(ratio), 80.0);
+	REQUIRE(plan.macsPerSample < 0.25 * double(single) / double(ratio));
+
+	double macs = 0.0;
+	double latency = 0.0;
+	size_t decimated = 1;
+	for (size_t stage = 0; stage < plan.rates.size(); ++stage) {
+		latency += double(plan.filterSizes[stage] - 1) / 2.0 * double(decimated);
+		decimated *= plan.rates[stage];
+		macs += double(plan.filterSizes[stage]) / double(decimated);
+	}
+	REQUIRE(plan.macsPerSample == Approx(macs));
+	REQUIRE(plan.latency == Approx(latency));
+}
+
+
+TEST_CASE("Multistage plan latency budget", "[Multistage]") {
+	const auto cheapest = PlanMultistage(64, 0.5f, 60.0f);
+	const auto bounded = PlanMultistage(64, 0.5f, 60.0f, 0.9 * cheapest.latency);
+	REQUIRE(bounded.latency <= 0.9 * cheapest.latency);
+	REQUIRE(bounded.macsPerSample >= cheapest.macsPerSample);
+
+	REQUIRE_THROWS(PlanMultistage(64, 0.5f, 60.0f, 1.0));
+	REQUIRE_THROWS(PlanMultistage(1, 0.5f, 60.0f));
+	REQUIRE_THROWS(PlanMultistage(8, 1.0f, 60.0f));
+	REQUIRE_THROWS(PlanMultistage(8, 0.5f, 0.0f));
+}
+
+
+TEST_CASE("Multistage decimator", "[Multistage]") {
+	constexpr size_t ratio = 24;
+	constexpr size_t length = ratio * 400;
+	MultistageDecimator<float> decimator{ ratio, 0.8f, 60.0f };
+	const auto& plan = decimator.plan();
+	REQUIRE(decimator.numStages() == plan.rates.size());
+	for (size_t stage = 0; stage < decimator.numStages(); ++stage) {
+		REQUIRE(decimator.stageFilter(stage).size() == plan.filterSizes[stage]);
+	}
+	const size_t settled = size_t(std::ceil(plan.latency / double(ratio))) * 2;
+
+	SECTION("Passband") {
+		const double frequency = 0.5 / double(ratio);
+		const auto signal = Sine(length, frequency);
+		Signal<float> result(length / ratio);
+		size_t first = 0;
+		for (const size_t blockSize : { ratio, 5 * ratio, 394 * ratio }) {
+			decimator.process(AsView(result).subsignal(first / ratio, blockSize / ratio), AsConstView(signal).subsignal(first, blockSize));
+			first += blockSize;
+		}
+
+		Signal<float> expected(result.size());
+		for (size_t i = 0; i < expected.size(); ++i) {
+			expected[i] = float(std::sin(pi_v<double> * frequency * (double(i * ratio) - plan.latency)));
+		}
+		const Signal<float> difference = result - expected;
+		const auto error = AsConstView(difference).subsignal(settled);
+		REQUIRE(Max(Abs(error)) < 0.01f);
+	}
+	SECTION("Aliasing") {
+		const double frequency = 1.5 / double(ratio);
+		const auto signal = Sine(length, frequency);
+		Signal<float> result(length / ratio);
+		decimator.process(result, signal);
+		REQUIRE(Max(Abs(AsConstView(result).subsignal(settled))) < 0.003f);
+	}
+	SECTION("Reset") {
+		const auto signal = Sine(length, 0.3 / double(ratio));
+		Signal<float> result1(length / ratio), result2(length / ratio);
+		decimator.process(result1, signal);
+		decimator.reset();
+		decimator.process(result2, signal);
+		REQUIRE(Max(Abs(result1 - result2)) == 0.0f);
+	}
+}
+
+
+TEST_CASE("Multistage interpolator", "[Multistage]") {
+	constexpr size_t ratio = 12;
+	constexpr size_t length = 400;
+	MultistageInterpolator<float> interpolator{ ratio, 0.8f, 60.0f };
+	const auto& plan = interpolator.plan();
+	const size_t settled = size_t(std::ceil(plan.latency)) * 2;
+
+	const double frequency = 0.5;
+	const auto signal = Sine(length, frequency);
+	Signal<float> result(length * ratio);
+	size_t first = 0;
+	for (const size_t blockSize : { 1, 6, 393 }) {
+		interpolator.process(AsView(result).subsignal(first * ratio, blockSize * ratio), AsConstView(signal).subsignal(first, blockSize));
+		first += blockSize;
+	}
+
+	// The images of the low-rate sine are removed, so the output is the same sine sampled at the high rate.
+	const auto expected = Sine(length * ratio, frequency / double(ratio), -plan.latency);
+	const Signal<float> difference = result - expected;
+	const auto error = AsConstView(difference).subsignal(settled);
+	REQUIRE(Max(Abs(error)) < 0.01f);
+}
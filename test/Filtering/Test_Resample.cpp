@@ -3,6 +3,7 @@
 #include <dspbb/Filtering/Resample.hpp>
 #include <dspbb/Math/Convolution.hpp>
 
+#include <algorithm>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cmath>
@@ -29,6 +30,44 @@ TEST_CASE("Decimate", "[Interpolation]") {
 }
 
 
+TEST_CASE("Filter decimate", "[Interpolation]") {
+	constexpr size_t signalSize = 240;
+
+	for (const size_t rate : { 1, 3, 8 }) {
+		for (const size_t filterSize : { 1, 2, 7, 8, 33 }) {
+			const auto signal = RandomSignal<float, TIME_DOMAIN>(signalSize);
+			const auto filter = RandomSignal<float, TIME_DOMAIN>(filterSize);
+			const auto expected = Decimate(Convolution(signal, filter, 0, signalSize), rate);
+
+			Signal<float> state(filterSize - 1, 0.0f);
+			Signal<float> result;
+			for (const size_t blockSize : { 24, 96, 120 }) {
+				const size_t first = result.size() * rate;
+				const auto block = FilterDecimate(AsConstView(signal).subsignal(first, blockSize), filter, rate, state);
+				result.insert(result.end(), block.begin(), block.end());
+			}
+
+			INFO("rate=" << rate << ", filterSize=" << filterSize);
+			REQUIRE(result.size() == expected.size());
+			REQUIRE(Max(Abs(result - expected)) < 1e-5f);
+		}
+	}
+}
+
+
+TEST_CASE("Filter decimate uneven block", "[Interpolation]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(10);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(5);
+	const auto expected = Decimate(Convolution(signal, filter, 0, signal.size()), 3);
+
+	Signal<float> state(filter.size() - 1, 0.0f);
+	const auto result = FilterDecimate(signal, filter, 3, state);
+	REQUIRE(result.size() == 4);
+	REQUIRE(Max(Abs(result - expected)) < 1e-5f);
+	REQUIRE(std::equal(state.begin(), state.end(), signal.end() - 4));
+}
+
+
 TEST_CASE("Expand", "[Interpolation]") {
 	const Signal<float> s = { 1, 2, 3 };
 	const Signal<float> e = Expand(s, 3);
@@ -38,6 +77,31 @@ TEST_CASE("Expand", "[Interpolation]") {
 	REQUIRE(Max(Abs(e - exp)) == Approx(0.0f));
 }
 
+
+TEST_CASE("Filter interpolate", "[Interpolation]") {
+	constexpr size_t signalSize = 120;
+
+	for (const size_t rate : { 1, 3, 8 }) {
+		for (const size_t filterSize : { 1, 2, 7, 8, 33 }) {
+			const auto signal = RandomSignal<float, TIME_DOMAIN>(signalSize);
+			const auto filter = RandomSignal<float, TIME_DOMAIN>(filterSize);
+			const auto expected = Convolution(Expand(signal, rate), filter, 0, signalSize * rate);
+
+			Signal<float> state((filterSize + rate - 1) / rate - 1, 0.0f);
+			Signal<float> result;
+			for (const size_t blockSize : { 1, 5, 50, 64 }) {
+				const size_t first = result.size() / rate;
+				const auto block = FilterInterpolate(AsConstView(signal).subsignal(first, blockSize), filter, rate, state);
+				result.insert(result.end(), block.begin(), block.end());
+			}
+
+			INFO("rate=" << rate << ", filterSize=" << filterSize);
+			REQUIRE(result.size() == expected.size());
+			REQUIRE(Max(Abs(result - expected)) < 1e-5f);
+		}
+	}
+}
+
 TEST_CASE("Interpolation full", "[Interpolation]") {
 	constexpr int interpRate = 5;
 	constexpr int signalSize = 1024;
@@ -3,6 +3,7 @@
 #include <array>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <vector>
 
 
 using namespace dspbb;
@@ -66,6 +67,16 @@ TEST_CASE("Convolution accumulate small filter", "[Kernels - Convolution]") {
 }
 
 
+TEST_CASE("Convolution accumulate into output", "[Kernels - Convolution]") {
+	std::array<float, 31> out;
+	std::fill(out.begin(), out.end(), 1.0f);
+	kernels::ConvolutionReduce(ur.begin(), ur.end(), vr.begin(), vr.end(), out.begin(), out.end(), 0, true);
+	for (size_t i = 0; i < out.size(); ++i) {
+		REQUIRE(out[i] == urvr_full[i] + 1.0f);
+	}
+}
+
+
 TEST_CASE("Convolution acc_vec central", "[Kernels - Convolution]") {
 	std::array<float, 9> out;
 	kernels::ConvolutionReduceVec(ur.begin(), ur.end(), vr.begin(), vr.end(), out.begin(), out.end(), 11);
@@ -86,4 +97,172 @@ TEST_CASE("Convolution acc_vec small filter", "[Kernels - Convolution]") {
 	kernels::ConvolutionNaive(u.begin(), u.end(), v.begin(), v.end(), ref.begin(), ref.end(), 0);
 	kernels::ConvolutionReduceVec(u.begin(), u.end(), v.begin(), v.end(), out.begin(), out.end(), 0);
 	REQUIRE(out == ref);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Convolution blocked central", "[Kernels - Convolution]") {
+	std::array<float, 9> out;
+	kernels::ConvolutionReduceBlocked(ur.begin(), ur.end(), vr.begin(), vr.end(), out.begin(), out.end(), 11);
+	REQUIRE(out == urvr_central);
+}
+
+TEST_CASE("Convolution blocked full", "[Kernels - Convolution]") {
+	std::array<float, 31> out;
+	kernels::ConvolutionReduceBlocked(ur.begin(), ur.end(), vr.begin(), vr.end(), out.begin(), out.end(), 0);
+	REQUIRE(out == urvr_full);
+}
+
+TEST_CASE("Convolution blocked long", "[Kernels - Convolution]") {
+	std::array<float, 300> u;
+	std::array<float, 45> v;
+	for (size_t i = 0; i < u.size(); ++i) {
+		u[i] = float(int(i * 7) % 13 - 6);
+	}
+	for (size_t i = 0; i < v.size(); ++i) {
+		v[i] = float(int(i * 5) % 11 - 5);
+	}
+	std::array<float, 344> ref;
+	std::array<float, 344> out;
+	kernels::ConvolutionNaive(u.begin(), u.end(), v.begin(), v.end(), ref.begin(), ref.end(), 0);
+
+	SECTION("Full") {
+		kernels::ConvolutionReduceBlocked(u.begin(), u.end(), v.begin(), v.end(), out.begin(), out.end(), 0);
+		REQUIRE(out == ref);
+	}
+	SECTION("Swapped & offset") {
+		kernels::ConvolutionReduceBlocked<8>(v.begin(), v.end(), u.begin(), u.end(), out.begin() + 30, out.end() - 20, 30);
+		REQUIRE(std::equal(out.begin() + 30, out.end() - 20, ref.begin() + 30));
+	}
+	SECTION("Accumulate") {
+		std::fill(out.begin(), out.end(), 1.0f);
+		kernels::ConvolutionReduceBlocked(u.begin(), u.end(), v.begin(), v.end(), out.begin(), out.end(), 0, true, std::plus<>{});
+		for (size_t i = 0; i < out.size(); ++i) {
+			REQUIRE(out[i] == ref[i] + 1.0f);
+		}
+	}
+}
+
+TEST_CASE("Convolution tiled", "[Kernels - Convolution]") {
+	std::array<float, 300> u;
+	std::array<float, 45> v;
+	for (size_t i = 0; i < u.size(); ++i) {
+		u[i] = float(int(i * 7) % 13 - 6);
+	}
+	for (size_t i = 0; i < v.size(); ++i) {
+		v[i] = float(int(i * 5) % 11 - 5);
+	}
+	std::array<float, 344> ref;
+	std::array<float, 344> out;
+	kernels::ConvolutionNaive(u.begin(), u.end(), v.begin(), v.end(), ref.begin(), ref.end(), 0);
+
+	SECTION("Full") {
+		kernels::ConvolutionReduceTiled(u.begin(), u.end(), v.begin(), v.end(), out.begin(), out.end(), 0, 17, 10);
+		REQUIRE(out == ref);
+	}
+	SECTION("Swapped & offset") {
+		kernels::ConvolutionReduceTiled(v.begin(), v.end(), u.begin(), u.end(), out.begin() + 30, out.end() - 20, 30, 64, 7);
+		REQUIRE(std::equal(out.begin() + 30, out.end() - 20, ref.begin() + 30));
+	}
+	SECTION("Accumulate") {
+		std::fill(out.begin(), out.end(), 1.0f);
+		kernels::ConvolutionReduceTiled(u.begin(), u.end(), v.begin(), v.end(), out.begin(), out.end(), 0, 33, 16, true, std::plus<>{});
+		for (size_t i = 0; i < out.size(); ++i) {
+			REQUIRE(out[i] == ref[i] + 1.0f);
+		}
+	}
+}
+
+template <size_t N>
+void TestConvolutionFixed() {
+	std::array<float, 300> u;
+	std::array<float, N> v;
+	for (size_t i = 0; i < u.size(); ++i) {
+		u[i] = float(int(i * 7) % 13 - 6);
+	}
+	for (size_t i = 0; i < v.size(); ++i) {
+		v[i] = float(int(i * 5) % 11 - 5);
+	}
+	std::array<float, 300 + N - 1> ref;
+	std::array<float, 300 + N - 1> out;
+	kernels::ConvolutionNaive(u.begin(), u.end(), v.begin(), v.end(), ref.begin(), ref.end(), 0);
+
+	kernels::ConvolutionFixed<N>(v.begin(), u.begin(), u.end(), out.begin(), out.end(), 0);
+	REQUIRE(out == ref);
+
+	std::fill(out.begin(), out.end(), 0.0f);
+	kernels::ConvolutionFixed<N>(v.begin(), u.begin(), u.end(), out.begin() + 9, out.end() - 2, 9);
+	REQUIRE(std::equal(out.begin() + 9, out.end() - 2, ref.begin() + 9));
+
+	std::fill(out.begin(), out.end(), 1.0f);
+	kernels::ConvolutionFixed<N>(v.begin(), u.begin(), u.end(), out.begin(), out.end(), 0, true);
+	for (size_t i = 0; i < out.size(); ++i) {
+		REQUIRE(out[i] == ref[i] + 1.0f);
+	}
+}
+
+TEST_CASE("Convolution fixed", "[Kernels - Convolution]") {
+	TestConvolutionFixed<1>();
+	TestConvolutionFixed<3>();
+	TestConvolutionFixed<5>();
+	TestConvolutionFixed<7>();
+	TestConvolutionFixed<15>();
+	TestConvolutionFixed<31>();
+}
+
+TEST_CASE("Convolution symmetric", "[Kernels - Convolution]") {
+	std::array<float, 300> u;
+	for (size_t i = 0; i < u.size(); ++i) {
+		u[i] = float(int(i * 7) % 13 - 6);
+	}
+
+	for (size_t filterSize : { 1, 2, 23, 24, 45 }) {
+		for (bool antisymmetric : { false, true }) {
+			std::vector<float> half((filterSize + 1) / 2);
+			std::vector<float> v(filterSize);
+			for (size_t i = 0; i < half.size(); ++i) {
+				half[i] = float(int(i * 5) % 11 - 5);
+				v[i] = half[i];
+				v[filterSize - 1 - i] = antisymmetric && filterSize - 1 - i != i ? -half[i] : half[i];
+			}
+			std::vector<float> ref(u.size() + filterSize - 1);
+			std::vector<float> out(ref.size());
+			kernels::ConvolutionNaive(u.begin(), u.end(), v.begin(), v.end(), ref.begin(), ref.end(), 0);
+
+			kernels::ConvolutionSymmetric(half.begin(), half.end(), filterSize, antisymmetric, u.begin(), u.end(), out.begin(), out.end(), 0);
+			REQUIRE(out == ref);
+
+			std::fill(out.begin(), out.end(), 0.0f);
+			kernels::ConvolutionSymmetric<8>(half.begin(), half.end(), filterSize, antisymmetric, u.begin(), u.end(), out.begin() + 7, out.end() - 5, 7);
+			REQUIRE(std::equal(out.begin() + 7, out.end() - 5, ref.begin() + 7));
+
+			std::fill(out.begin(), out.end(), 1.0f);
+			kernels::ConvolutionSymmetric(half.begin(), half.end(), filterSize, antisymmetric, u.begin(), u.end(), out.begin(), out.end(), 0, true, std::plus<>{});
+			for (size_t i = 0; i < out.size(); ++i) {
+				REQUIRE(out[i] == ref[i] + 1.0f);
+			}
+		}
+	}
+}
+
+TEST_CASE("Convolution dispatch", "[Kernels - Convolution]") {
+	using kernels::eConvolutionKernel;
+	const std::array kernelTypes = { eConvolutionKernel::NAIVE, eConvolutionKernel::SLIDE, eConvolutionKernel::REDUCE, eConvolutionKernel::REDUCE_VEC, eConvolutionKernel::REDUCE_BLOCKED, eConvolutionKernel::REDUCE_TILED };
+
+	std::array<float, 31> out;
+	for (const auto kernel : kernelTypes) {
+		std::fill(out.begin(), out.end(), 5.0f);
+		kernels::ConvolutionDispatch(kernel, ur.begin(), ur.end(), vr.begin(), vr.end(), out.begin() + 3, out.end() - 4, 3);
+		REQUIRE(std::equal(out.begin() + 3, out.end() - 4, urvr_full.begin() + 3));
+		REQUIRE(out[2] == 5.0f);
+		REQUIRE(out[27] == 5.0f);
+
+		kernels::ConvolutionDispatch(kernel, vr.begin(), vr.end(), ur.begin(), ur.end(), out.begin() + 3, out.end() - 4, 3, true);
+		for (size_t i = 3; i < out.size() - 4; ++i) {
+			REQUIRE(out[i] == 2.0f * urvr_full[i]);
+		}
+	}
+
+	REQUIRE(kernels::SelectConvolutionKernel(1000, 12) == eConvolutionKernel::SLIDE);
+	REQUIRE(kernels::SelectConvolutionKernel(1000, 200) == eConvolutionKernel::REDUCE_BLOCKED);
+	REQUIRE(kernels::SelectConvolutionKernel(1000, 1000) == eConvolutionKernel::REDUCE_VEC);
+	REQUIRE(kernels::SelectConvolutionKernel(100000, 8192) == eConvolutionKernel::REDUCE_TILED);
+}
@@ -1,7 +1,9 @@
 #include <dspbb/Math/Convolution.hpp>
 
+#include <algorithm>
 #include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <cmath>
 #include <complex>
 
 
@@ -191,3 +193,51 @@ TEST_CASE("3-operand full & central", "[Convolution]") {
 		REQUIRE(centralOut[i] == centralExpected[i]);
 	}
 }
+
+TEST_CASE("Parallel bitwise identical", "[Convolution]") {
+	Signal<float> u(50000);
+	Signal<float> v(200);
+	for (size_t i = 0; i < u.size(); ++i) {
+		u[i] = std::sin(0.37f * float(i));
+	}
+	for (size_t i = 0; i < v.size(); ++i) {
+		v[i] = std::cos(0.11f * float(i)) / float(i + 1);
+	}
+
+	SECTION("Full") {
+		const auto expected = Convolution(u, v, CONV_FULL);
+		const auto result = Convolution(u, v, CONV_FULL, ParallelExecution{ 3 });
+		REQUIRE(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+	}
+	SECTION("Central") {
+		const auto expected = Convolution(u, v, CONV_CENTRAL);
+		const auto result = Convolution(u, v, CONV_CENTRAL, ParallelExecution{ 4 });
+		REQUIRE(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+	}
+	SECTION("Offset & accumulate") {
+		Signal<float> expected(30000, 1.0f);
+		Signal<float> result(30000, 1.0f);
+		Convolution(expected, u, v, 1234, false);
+		Convolution(result, u, v, 1234, ParallelExecution{ 2 }, false);
+		REQUIRE(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+	}
+}
+
+TEST_CASE("Long filter tiled", "[Convolution]") {
+	Signal<double> u(20000);
+	Signal<double> v(3000);
+	for (size_t i = 0; i < u.size(); ++i) {
+		u[i] = std::sin(0.37 * double(i));
+	}
+	for (size_t i = 0; i < v.size(); ++i) {
+		v[i] = std::cos(0.11 * double(i)) / double(i + 1);
+	}
+	Signal<double> expected(u.size() - v.size() + 1);
+	kernels::ConvolutionNaive(u.begin(), u.end(), v.begin(), v.end(), expected.begin(), expected.end(), v.size() - 1);
+
+	const auto result = Convolution(u, v, CONV_CENTRAL);
+	REQUIRE(result.size() == expected.size());
+	for (size_t i = 0; i < result.size(); ++i) {
+		REQUIRE(std::abs(result[i] - expected[i]) < 1e-10);
+	}
+}
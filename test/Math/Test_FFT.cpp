@@ -132,6 +132,189 @@ TEST_CASE("FFT - Half real identity", "[FFT]") {
 	}
 }
 
+TEST_CASE("FFT plan - Real forward", "[FFT]") {
+	// 1009 is prime and is computed with Bluestein's algorithm.
+	const std::array<size_t, 6> sizes = { 1, 2, 63, 64, 65, 1009 };
+
+	for (auto s : sizes) {
+		const auto signal = RandomSignal<float, TIME_DOMAIN>(s);
+		FftPlan<float> plan{ s };
+		Spectrum<std::complex<float>> half(s / 2 + 1);
+		Spectrum<std::complex<float>> full(s);
+		Fft(half, signal, plan);
+		Fft(full, signal, plan);
+		const auto expectedHalf = Fft(signal, FFT_HALF);
+		const auto expectedFull = Fft(signal, FFT_FULL);
+		REQUIRE(plan.size() == s);
+		REQUIRE(Max(Abs(half - expectedHalf)) < 0.001f);
+		REQUIRE(Max(Abs(full - expectedFull)) < 0.001f);
+	}
+}
+
+TEST_CASE("FFT plan - Real identity", "[FFT]") {
+	const std::array<size_t, 6> sizes = { 1, 2, 63, 64, 65, 1009 };
+
+	for (auto s : sizes) {
+		const auto signal = RandomSignal<float, TIME_DOMAIN>(s);
+		FftPlan<float> plan{ s };
+		Spectrum<std::complex<float>> spectrum(s / 2 + 1);
+		Signal<float> repro(s);
+		Fft(spectrum, signal, plan);
+		Ifft(repro, spectrum, plan);
+		REQUIRE(Max(Abs(signal - repro)) < 0.001f);
+	}
+}
+
+TEST_CASE("FFT plan - Complex identity", "[FFT]") {
+	const std::array<size_t, 4> sizes = { 1, 64, 65, 1009 };
+
+	for (auto s : sizes) {
+		const auto signal = RandomSignal<std::complex<double>, TIME_DOMAIN>(s);
+		FftPlan<std::complex<double>> plan{ s };
+		Spectrum<std::complex<double>> spectrum(s);
+		Signal<std::complex<double>> repro(s);
+		Fft(spectrum, signal, plan);
+		Ifft(repro, spectrum, plan);
+		REQUIRE(Max(Abs(spectrum - Fft(signal))) < 1e-9);
+		REQUIRE(Max(Abs(signal - repro)) < 1e-9);
+	}
+}
+
+TEST_CASE("FFT plan - Complex in-place", "[FFT]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(fftSize);
+	FftPlan<std::complex<float>> plan{ fftSize };
+	Signal<std::complex<float>> buffer = signal;
+	plan.execute(AsView<FREQUENCY_DOMAIN>(buffer.begin(), buffer.end()), AsConstView(buffer));
+	plan.execute(AsView(buffer), AsConstView<FREQUENCY_DOMAIN>(buffer.begin(), buffer.end()));
+	REQUIRE(Max(Abs(signal - buffer)) < 0.001f);
+}
+
+TEST_CASE("FFT batch plan - Real", "[FFT]") {
+	const std::array<size_t, 6> sizes = { 1, 2, 63, 64, 65, 1009 };
+	const size_t numChannels = 2 * FftBatchPlan<float>::lanes() + 1;
+
+	for (auto s : sizes) {
+		const auto signal = RandomSignal<float, TIME_DOMAIN>(numChannels * s);
+		FftBatchPlan<float> plan{ s };
+		Spectrum<std::complex<float>> half(numChannels * (s / 2 + 1));
+		Spectrum<std::complex<float>> full(numChannels * s);
+		FftBatch(half, signal, numChannels, plan);
+		FftBatch(full, signal, numChannels, plan);
+		REQUIRE(plan.size() == s);
+		for (size_t channel = 0; channel < numChannels; ++channel) {
+			const auto channelSignal = AsConstView(signal).subsignal(channel * s, s);
+			const auto expectedHalf = Fft(channelSignal, FFT_HALF);
+			const auto expectedFull = Fft(channelSignal, FFT_FULL);
+			REQUIRE(Max(Abs(AsConstView(half).subsignal(channel * expectedHalf.size(), expectedHalf.size()) - expectedHalf)) < 0.001f);
+			REQUIRE(Max(Abs(AsConstView(full).subsignal(channel * s, s) - expectedFull)) < 0.001f);
+		}
+	}
+}
+
+TEST_CASE("FFT batch plan - Complex", "[FFT]") {
+	const std::array<size_t, 4> sizes = { 1, 64, 65, 1009 };
+	const size_t numChannels = FftBatchPlan<std::complex<double>>::lanes() + 1;
+
+	for (auto s : sizes) {
+		const auto signal = RandomSignal<std::complex<double>, TIME_DOMAIN>(numChannels * s);
+		FftBatchPlan<std::complex<double>> plan{ s };
+		Spectrum<std::complex<double>> spectrum(numChannels * s);
+		FftBatch(spectrum, signal, numChannels, plan);
+		for (size_t channel = 0; channel < numChannels; ++channel) {
+			const auto expected = Fft(AsConstView(signal).subsignal(channel * s, s));
+			REQUIRE(Max(Abs(AsConstView(spectrum).subsignal(channel * s, s) - expected)) < 1e-9);
+		}
+	}
+}
+
+TEST_CASE("FFT batch - Planar real", "[FFT]") {
+	constexpr size_t numChannels = 7;
+	constexpr size_t length = 65;
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(numChannels * length);
+	Spectrum<std::complex<float>> half(numChannels * (length / 2 + 1));
+	Spectrum<std::complex<float>> full(numChannels * length);
+	Signal<float> repro(numChannels * length);
+	FftBatch(half, signal, numChannels, 3);
+	FftBatch(full, signal, numChannels, 3);
+	IfftBatch(repro, half, numChannels, 3);
+
+	for (size_t channel = 0; channel < numChannels; ++channel) {
+		const auto channelSignal = AsConstView(signal).subsignal(channel * length, length);
+		const auto expectedHalf = Fft(channelSignal, FFT_HALF);
+		const auto expectedFull = Fft(channelSignal, FFT_FULL);
+		REQUIRE(Max(Abs(AsConstView(half).subsignal(channel * expectedHalf.size(), expectedHalf.size()) - expectedHalf)) < 0.001f);
+		REQUIRE(Max(Abs(AsConstView(full).subsignal(channel * length, length) - expectedFull)) < 0.001f);
+	}
+	REQUIRE(Max(Abs(signal - repro)) < 0.001f);
+}
+
+TEST_CASE("FFT batch - Planar complex", "[FFT]") {
+	constexpr size_t numChannels = 5;
+	constexpr size_t length = 64;
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(numChannels * length);
+	Spectrum<std::complex<float>> spectrum(numChannels * length);
+	Signal<std::complex<float>> repro(numChannels * length);
+	FftBatch(spectrum, signal, numChannels);
+	IfftBatch(repro, spectrum, numChannels);
+
+	for (size_t channel = 0; channel < numChannels; ++channel) {
+		const auto expected = Fft(AsConstView(signal).subsignal(channel * length, length));
+		REQUIRE(Max(Abs(AsConstView(spectrum).subsignal(channel * length, length) - expected)) < 0.001f);
+	}
+	REQUIRE(Max(Abs(signal - repro)) < 0.001f);
+}
+
+TEST_CASE("FFT batch - List of views", "[FFT]") {
+	constexpr size_t numChannels = 11;
+	constexpr size_t length = 63;
+	std::vector<Signal<float>> signals;
+	std::vector<Spectrum<std::complex<float>>> spectra(numChannels, Spectrum<std::complex<float>>(length / 2 + 1));
+	std::vector<Signal<float>> repros(numChannels, Signal<float>(length));
+	for (size_t channel = 0; channel < numChannels; ++channel) {
+		signals.push_back(RandomSignal<float, TIME_DOMAIN>(length));
+	}
+	std::vector<SpectrumView<std::complex<float>>> spectrumViews(spectra.begin(), spectra.end());
+
+	FftPlan<float> plan{ length };
+	FftBatch(spectrumViews, signals, plan, 4);
+	IfftBatch(repros, spectra, plan, 4);
+
+	for (size_t channel = 0; channel < numChannels; ++channel) {
+		REQUIRE(Max(Abs(spectra[channel] - Fft(signals[channel], FFT_HALF))) < 0.001f);
+		REQUIRE(Max(Abs(signals[channel] - repros[channel])) < 0.001f);
+	}
+}
+
+TEST_CASE("Hermitian view - Matches full spectrum", "[FFT]") {
+	const std::array<size_t, 5> sizes = { 1, 2, 63, 64, 65 };
+
+	for (auto s : sizes) {
+		const auto signal = RandomSignal<float, TIME_DOMAIN>(s);
+		const Spectrum<std::complex<float>> half = Fft(signal, FFT_HALF);
+		const Spectrum<std::complex<float>> full = Fft(signal, FFT_FULL);
+		const auto hermitian = AsHermitianView(half, s);
+		REQUIRE(hermitian.size() == full.size());
+		for (size_t k = 0; k < s; ++k) {
+			REQUIRE(hermitian[k] == full[k]);
+		}
+	}
+}
+
+TEST_CASE("Hermitian view - Multiply", "[FFT]") {
+	const std::array<size_t, 2> sizes = { 64, 65 };
+
+	for (auto s : sizes) {
+		const auto real = RandomSignal<float, TIME_DOMAIN>(s);
+		const auto complex = RandomSignal<std::complex<float>, TIME_DOMAIN>(s);
+		const Spectrum<std::complex<float>> realFd = Fft(real, FFT_HALF);
+		const Spectrum<std::complex<float>> complexFd = Fft(complex);
+		Spectrum<std::complex<float>> product(s);
+		MultiplyHermitian(product, complexFd, AsHermitianView(realFd, s));
+		const Spectrum<std::complex<float>> expected = complexFd * Fft(real, FFT_FULL);
+		REQUIRE(Max(Abs(product - expected)) < 1e-4f);
+	}
+}
+
 TEST_CASE("FFT shift even", "[FFT]") {
 	const Spectrum<float> s = { 0, 1, 2, 3, 4, 5 };
 	const Spectrum<float> e = { 3, 4, 5, 0, 1, 2 };
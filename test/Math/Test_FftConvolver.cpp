@@ -0,0 +1,51 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Math/Convolution.hpp>
+#include <dspbb/Math/FftConvolver.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+TEST_CASE("FFT convolver - Real blocks", "[FftConvolver]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(500);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(37);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+	const std::array<size_t, 5> blockSizes = { 1, 13, 32, 33, 100 };
+
+	for (auto blockSize : blockSizes) {
+		FftConvolver<float> convolver{ filter, 32 };
+		REQUIRE(convolver.fftSize() == 128);
+		const auto out = ProcessInBlocks(convolver, signal, blockSize);
+		REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+	}
+}
+
+TEST_CASE("FFT convolver - Complex blocks", "[FftConvolver]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(500);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(20);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+
+	FftConvolver<std::complex<float>> convolver{ filter, 64 };
+	const auto out = ProcessInBlocks(convolver, signal, 50);
+	REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("FFT convolver - Reset", "[FftConvolver]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(100);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(16);
+
+	FftConvolver<float> convolver{ filter, 40 };
+	const auto first = ProcessInBlocks(convolver, signal, 40);
+	convolver.reset();
+	const auto second = ProcessInBlocks(convolver, signal, 40);
+	REQUIRE(Max(Abs(first - second)) == 0.0f);
+}
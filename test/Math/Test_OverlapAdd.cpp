@@ -170,6 +170,85 @@ TEST_CASE("OLA 3-operand full & central", "[OverlapAdd]") {
 	}
 }
 
+TEST_CASE("OLA workspace reuse", "[OverlapAdd]") {
+	OverlapWorkspace<float> workspace{ 64 };
+	REQUIRE(workspace.chunkSize() == 64);
+	for (size_t filterSize : { 7, 16, 32 }) {
+		const auto signal = RandomSignal<float, TIME_DOMAIN>(200);
+		const auto filter = RandomSignal<float, TIME_DOMAIN>(filterSize);
+		const auto expected = Convolution(signal, filter, CONV_FULL);
+		Signal<float> out(expected.size());
+		OverlapAdd(out, signal, filter, CONV_FULL, workspace);
+		REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+	}
+}
+
+TEST_CASE("OLA workspace swapped operands", "[OverlapAdd]") {
+	const auto u = RandomSignal<float, TIME_DOMAIN>(9);
+	const auto v = RandomSignal<float, TIME_DOMAIN>(120);
+	const auto expected = Convolution(u, v, CONV_CENTRAL);
+	Signal<float> out(expected.size());
+	OverlapWorkspace<float> workspace{ 32 };
+	OverlapAdd(out, u, v, CONV_CENTRAL, workspace);
+	REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLA workspace real-complex", "[OverlapAdd]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(95);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(13);
+	const auto expected = Convolution(signal, filter, CONV_CENTRAL);
+	Signal<std::complex<float>> out(expected.size());
+	OverlapWorkspace<float, std::complex<float>> workspace{ 33 };
+	OverlapAdd(out, signal, filter, CONV_CENTRAL, workspace);
+	OverlapAdd(out, signal, filter, CONV_CENTRAL, workspace, false);
+	for (size_t i = 0; i < out.size(); ++i) {
+		REQUIRE(out[i] == ApproxComplex(2.0f * expected[i]).margin(1e-4f));
+	}
+}
+
+TEST_CASE("OLA workspace mixed types shorter first", "[OverlapAdd]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(13);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(95);
+	Signal<std::complex<float>> out(ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
+	OverlapWorkspace<float, std::complex<float>> workspace{ 33 };
+	REQUIRE_THROWS_AS(OverlapAdd(out, signal, filter, 0, workspace), std::invalid_argument);
+}
+
+TEST_CASE("OLA workspace too small", "[OverlapAdd]") {
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(40);
+	OverlapWorkspace<float> workspace{ 32 };
+	REQUIRE_THROWS_AS(workspace.setFilter(filter), std::invalid_argument);
+}
+
+TEST_CASE("OLA parallel bitwise identical", "[OverlapAdd]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(5000);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(23);
+	const auto serial = OverlapAdd(signal, filter, CONV_FULL, 64);
+	for (size_t numThreads : { 1, 2, 3, 7 }) {
+		const auto parallel = OverlapAdd(signal, filter, CONV_FULL, ParallelExecution{ numThreads }, 64);
+		REQUIRE(parallel.size() == serial.size());
+		REQUIRE(std::equal(parallel.begin(), parallel.end(), serial.begin()));
+	}
+}
+
+TEST_CASE("OLA parallel central", "[OverlapAdd]") {
+	const auto signal = RandomSignal<std::complex<double>, TIME_DOMAIN>(3000);
+	const auto filter = RandomSignal<std::complex<double>, TIME_DOMAIN>(41);
+	const auto serial = OverlapAdd(signal, filter, CONV_CENTRAL);
+	const auto parallel = OverlapAdd(signal, filter, CONV_CENTRAL, ParallelExecution{ 4 });
+	REQUIRE(std::equal(parallel.begin(), parallel.end(), serial.begin(), serial.end()));
+}
+
+TEST_CASE("OLA parallel offset & accumulate", "[OverlapAdd]") {
+	const auto u = RandomSignal<float, TIME_DOMAIN>(19);
+	const auto v = RandomSignal<float, TIME_DOMAIN>(2000);
+	Signal<float> serial(1500, 1.0f);
+	Signal<float> parallel(1500, 1.0f);
+	OverlapAdd(serial, u, v, 300, 64, false);
+	OverlapAdd(parallel, u, v, 300, ParallelExecution{ 5 }, 64, false);
+	REQUIRE(std::equal(parallel.begin(), parallel.end(), serial.begin(), serial.end()));
+}
+
 TEST_CASE("OLA optimal theoretical FFT size", "[OverlapAdd]") {
 	const double s1 = impl::ola::OptimalTheoreticalSize(12, 6, 1, 2);
 	REQUIRE(s1 == Approx(65.114).margin(0.001f));
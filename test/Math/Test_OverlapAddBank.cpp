@@ -0,0 +1,97 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Math/Convolution.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/OverlapAddBank.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+template <class T>
+std::vector<Signal<T>> RandomFilters(size_t count, size_t size) {
+	std::vector<Signal<T>> filters;
+	for (size_t i = 0; i < count; ++i) {
+		filters.push_back(RandomSignal<T, TIME_DOMAIN>(size));
+	}
+	return filters;
+}
+
+
+TEST_CASE("Overlap-add bank - Full", "[OverlapAddBank]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(500);
+	const auto filters = RandomFilters<float>(5, 37);
+
+	OverlapAddBank<float> bank{ filters, 128 };
+	REQUIRE(bank.numFilters() == 5);
+	REQUIRE(bank.filterSize() == 37);
+	REQUIRE(bank.chunkSize() == 128);
+
+	std::vector<Signal<float>> outs(filters.size(), Signal<float>(ConvolutionLength(signal.size(), 37, CONV_FULL)));
+	bank.process(outs, signal, CONV_FULL);
+	for (size_t i = 0; i < filters.size(); ++i) {
+		const auto expected = Convolution(signal, filters[i], CONV_FULL);
+		REQUIRE(Max(Abs(outs[i] - expected)) == Approx(0).margin(0.001f));
+	}
+}
+
+TEST_CASE("Overlap-add bank - Central", "[OverlapAddBank]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(500);
+	const auto filters = RandomFilters<float>(3, 20);
+
+	OverlapAddBank<float> bank{ filters };
+	REQUIRE(bank.chunkSize() >= 2 * 20 - 1);
+
+	std::vector<Signal<float>> outs(filters.size(), Signal<float>(ConvolutionLength(signal.size(), 20, CONV_CENTRAL)));
+	bank.process(outs, signal, CONV_CENTRAL);
+	for (size_t i = 0; i < filters.size(); ++i) {
+		const auto expected = Convolution(signal, filters[i], CONV_CENTRAL);
+		REQUIRE(Max(Abs(outs[i] - expected)) == Approx(0).margin(0.001f));
+	}
+}
+
+TEST_CASE("Overlap-add bank - Offset & accumulate", "[OverlapAddBank]") {
+	const auto signal = RandomSignal<std::complex<double>, TIME_DOMAIN>(300);
+	const auto filters = RandomFilters<std::complex<double>>(4, 16);
+
+	OverlapAddBank<std::complex<double>> bank{ filters, 64 };
+	std::vector<Signal<std::complex<double>>> outs(filters.size(), Signal<std::complex<double>>(100, 1.0));
+	bank.process(outs, signal, 150, false);
+	for (size_t i = 0; i < filters.size(); ++i) {
+		const auto expected = Convolution(signal, filters[i], 150, 100) + 1.0;
+		REQUIRE(Max(Abs(outs[i] - expected)) == Approx(0).margin(1e-9));
+	}
+}
+
+TEST_CASE("Overlap-add bank - Parallel", "[OverlapAddBank]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(2000);
+	const auto filters = RandomFilters<float>(7, 33);
+
+	OverlapAddBank<float> bank{ filters, 128 };
+	std::vector<Signal<float>> serial(filters.size(), Signal<float>(ConvolutionLength(signal.size(), 33, CONV_FULL)));
+	std::vector<Signal<float>> parallel = serial;
+	bank.process(serial, signal, CONV_FULL);
+	bank.process(parallel, signal, CONV_FULL, ParallelExecution{ 3 });
+	for (size_t i = 0; i < filters.size(); ++i) {
+		REQUIRE(Max(Abs(serial[i] - parallel[i])) == 0.0f);
+	}
+}
+
+TEST_CASE("Overlap-add bank - Parallel offset & accumulate", "[OverlapAddBank]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(1000);
+	const auto filters = RandomFilters<float>(5, 24);
+
+	OverlapAddBank<float> bank{ filters, 64 };
+	std::vector<Signal<float>> serial(filters.size(), Signal<float>(300, 1.0f));
+	std::vector<Signal<float>> parallel = serial;
+	bank.process(serial, signal, 200, false);
+	bank.process(parallel, signal, 200, ParallelExecution{ 2 }, false);
+	for (size_t i = 0; i < filters.size(); ++i) {
+		REQUIRE(Max(Abs(serial[i] - parallel[i])) == 0.0f);
+	}
+}
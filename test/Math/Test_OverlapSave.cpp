@@ -0,0 +1,210 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/OverlapSave.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+
+using namespace dspbb;
+using namespace std::complex_literals;
+using Catch::Approx;
+
+
+TEST_CASE("OLS real-real central", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(3);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(7);
+	const auto ols = OverlapSave(signal, filter, CONV_CENTRAL, 16);
+	const auto conv = Convolution(signal, filter, CONV_CENTRAL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-real central long", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(63);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(7);
+	const auto ols = OverlapSave(signal, filter, CONV_CENTRAL, 16);
+	const auto conv = Convolution(signal, filter, CONV_CENTRAL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-real central big chunk", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(63);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(9);
+	const auto ols = OverlapSave(signal, filter, CONV_CENTRAL, 25);
+	const auto conv = Convolution(signal, filter, CONV_CENTRAL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-real central small chunk", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(63);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(9);
+	const auto ols = OverlapSave(signal, filter, CONV_CENTRAL, 17);
+	const auto conv = Convolution(signal, filter, CONV_CENTRAL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-real full", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(3);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(7);
+	const auto ols = OverlapSave(signal, filter, CONV_FULL, 16);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-real full long", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(63);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(7);
+	const auto ols = OverlapSave(signal, filter, CONV_FULL, 16);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	REQUIRE(ols.size() == conv.size());
+	const auto diff = ols - conv;
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-real full big chunk", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(63);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(9);
+	const auto ols = OverlapSave(signal, filter, CONV_FULL, 25);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-real full small chunk", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(63);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(9);
+	const auto ols = OverlapSave(signal, filter, CONV_FULL, 17);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS real-complex", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(107);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(16);
+	const auto ols = OverlapSave(signal, filter, CONV_CENTRAL, 46);
+	const auto conv = Convolution(signal, filter, CONV_CENTRAL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS complex-real", "[OverlapSave]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(107);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(16);
+	const auto ols = OverlapSave(signal, filter, CONV_CENTRAL, 46);
+	const auto conv = Convolution(signal, filter, CONV_CENTRAL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS complex-complex", "[OverlapSave]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(107);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(16);
+	const auto ols = OverlapSave(signal, filter, CONV_CENTRAL, 46);
+	const auto conv = Convolution(signal, filter, CONV_CENTRAL);
+	REQUIRE(ols.size() == conv.size());
+	REQUIRE(Max(Abs(ols - conv)) == Approx(0).margin(0.001f));
+}
+
+
+
+TEST_CASE("OLS Arbitrary offset middle", "[OverlapSave]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(107);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(16);
+	const auto ols = OverlapSave(signal, filter, 24, 7, 33);
+	const auto conv = Convolution(signal, filter, 24, 7);
+
+	REQUIRE(ols.size() == conv.size());
+	for (size_t i = 0; i < conv.size(); ++i) {
+		REQUIRE(ols[i] == ApproxComplex(conv[i]).margin(1e-4f));
+	}
+}
+
+TEST_CASE("OLS Arbitrary offset start", "[OverlapSave]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(107);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(16);
+	const auto ols = OverlapSave(signal, filter, 0, 7, 31);
+	const auto conv = Convolution(signal, filter, 0, 7);
+
+	REQUIRE(ols.size() == conv.size());
+	for (size_t i = 0; i < conv.size(); ++i) {
+		REQUIRE(ols[i] == ApproxComplex(conv[i]).margin(1e-4f));
+	}
+}
+
+TEST_CASE("OLS Arbitrary offset end", "[OverlapSave]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(107);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(16);
+	const auto ols = OverlapSave(signal, filter, 100, 7, 33);
+	const auto conv = Convolution(signal, filter, 100, 7);
+
+	REQUIRE(ols.size() == conv.size());
+	for (size_t i = 0; i < conv.size(); ++i) {
+		REQUIRE(ols[i] == ApproxComplex(conv[i]).margin(1e-4f));
+	}
+}
+
+TEST_CASE("OLS 3-operand full & central", "[OverlapSave]") {
+	const auto u = RandomSignal<std::complex<float>, TIME_DOMAIN>(107);
+	const auto v = RandomSignal<std::complex<float>, TIME_DOMAIN>(16);
+	const auto fullExpected = Convolution(v, u, CONV_FULL);
+	const auto centralExpected = Convolution(v, u, CONV_CENTRAL);
+	std::decay_t<decltype(fullExpected)> fullOut(fullExpected.size());
+	std::decay_t<decltype(centralExpected)> centralOut(centralExpected.size());
+
+	OverlapSave(fullOut, u, v, CONV_FULL, 33);
+	OverlapSave(centralOut, u, v, CONV_CENTRAL, 33);
+
+	for (size_t i = 0; i < fullOut.size(); ++i) {
+		REQUIRE(fullOut[i] == ApproxComplex(fullExpected[i]).margin(1e-4f));
+	}
+	for (size_t i = 0; i < centralOut.size(); ++i) {
+		REQUIRE(centralOut[i] == ApproxComplex(centralExpected[i]).margin(1e-4f));
+	}
+}
+
+TEST_CASE("OLS accumulate", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(107);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(16);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	Signal<float> ols(conv.size(), 1.0f);
+	OverlapSave(ols, signal, filter, CONV_FULL, 40, false);
+	REQUIRE(Max(Abs(ols - conv - 1.0f)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS workspace reuse", "[OverlapSave]") {
+	OverlapWorkspace<float> workspace{ 48 };
+	for (size_t filterSize : { 7, 16, 48 }) {
+		const auto signal = RandomSignal<float, TIME_DOMAIN>(200);
+		const auto filter = RandomSignal<float, TIME_DOMAIN>(filterSize);
+		const auto expected = Convolution(signal, filter, CONV_FULL);
+		Signal<float> out(expected.size());
+		OverlapSave(out, signal, filter, CONV_FULL, workspace);
+		REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+	}
+}
+
+TEST_CASE("OLS workspace real-complex", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(95);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(13);
+	const auto expected = Convolution(signal, filter, CONV_FULL);
+	Signal<std::complex<float>> out(expected.size());
+	OverlapWorkspace<float, std::complex<float>> workspace{ 33 };
+	OverlapSave(out, signal, filter, CONV_FULL, workspace);
+	REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("OLS workspace mixed types shorter first", "[OverlapSave]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(13);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(95);
+	Signal<std::complex<float>> out(ConvolutionLength(signal.size(), filter.size(), CONV_FULL));
+	OverlapWorkspace<float, std::complex<float>> workspace{ 128 };
+	REQUIRE_THROWS_AS(OverlapSave(out, signal, filter, 0, workspace), std::invalid_argument);
+}
@@ -0,0 +1,136 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Filtering/FIR/Filter.hpp>
+#include <dspbb/Math/Convolution.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/PartitionedConvolution.hpp>
+#include <dspbb/Math/Statistics.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+TEST_CASE("Uniform partitioned - Partition count", "[PartitionedConvolution]") {
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(100);
+	REQUIRE(PartitionedConvolver<float>{ filter, 32 }.partitionCount() == 4);
+	REQUIRE(PartitionedConvolver<float>{ filter, 25 }.partitionCount() == 4);
+	REQUIRE(PartitionedConvolver<float>{ filter, 128 }.partitionCount() == 1);
+}
+
+TEST_CASE("Uniform partitioned - Real", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(1000);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(300);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+	const std::array<size_t, 5> callSizes = { 1, 13, 32, 64, 200 };
+
+	for (auto callSize : callSizes) {
+		PartitionedConvolver<float> convolver{ filter, 32 };
+		const auto out = ProcessInBlocks(convolver, signal, callSize);
+		REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+	}
+}
+
+TEST_CASE("Uniform partitioned - Complex", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(500);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(77);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+
+	PartitionedConvolver<std::complex<float>> convolver{ filter, 16 };
+	const auto out = ProcessInBlocks(convolver, signal, 16);
+	REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("Uniform partitioned - Reset", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(200);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(50);
+
+	PartitionedConvolver<float> convolver{ filter, 16 };
+	const auto first = ProcessInBlocks(convolver, signal, 10);
+	convolver.reset();
+	const auto second = ProcessInBlocks(convolver, signal, 10);
+	REQUIRE(Max(Abs(first - second)) == 0.0f);
+}
+
+
+TEST_CASE("Non-uniform partitioned - Segment sizes", "[PartitionedConvolution]") {
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(1000);
+	REQUIRE(NonUniformConvolver<float>{ filter, 16 }.segmentBlockSizes() == std::vector<size_t>{ 16, 32, 64, 128, 256 });
+	REQUIRE(NonUniformConvolver<float>{ filter, 16, 64 }.segmentBlockSizes() == std::vector<size_t>{ 16, 32, 64 });
+	REQUIRE(NonUniformConvolver<float>{ filter, 1000 }.segmentBlockSizes().empty());
+}
+
+TEST_CASE("Non-uniform partitioned - Real", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(3000);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(1000);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+	const std::array<size_t, 4> callSizes = { 1, 13, 16, 100 };
+
+	for (auto callSize : callSizes) {
+		NonUniformConvolver<float> convolver{ filter, 16, 128 };
+		REQUIRE(convolver.latency() == 0);
+		const auto out = ProcessInBlocks(convolver, signal, callSize);
+		REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+	}
+}
+
+TEST_CASE("Non-uniform partitioned - Complex", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(800);
+	const auto filter = RandomSignal<std::complex<float>, TIME_DOMAIN>(300);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+
+	NonUniformConvolver<std::complex<float>> convolver{ filter, 8 };
+	const auto out = ProcessInBlocks(convolver, signal, 8);
+	REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("Non-uniform partitioned - Background thread", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(3000);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(1000);
+
+	NonUniformConvolver<float> foreground{ filter, 16 };
+	NonUniformConvolver<float> background{ filter, 16, 0, true };
+	const auto expected = ProcessInBlocks(foreground, signal, 16);
+	const auto out = ProcessInBlocks(background, signal, 16);
+	REQUIRE(Max(Abs(out - expected)) == 0.0f);
+
+	background.reset();
+	const auto afterReset = ProcessInBlocks(background, signal, 7);
+	REQUIRE(Max(Abs(afterReset - expected)) == Approx(0).margin(0.001f));
+}
+
+TEST_CASE("Non-uniform partitioned - Move with background thread", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(1000);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(500);
+
+	NonUniformConvolver<float> foreground{ filter, 16 };
+	const auto expected = ProcessInBlocks(foreground, signal, 16);
+
+	NonUniformConvolver<float> moved{ NonUniformConvolver<float>{ filter, 16, 0, true } };
+	REQUIRE(Max(Abs(ProcessInBlocks(moved, signal, 16) - expected)) == 0.0f);
+
+	NonUniformConvolver<float> assigned{ filter, 8, 0, true };
+	ProcessInBlocks(assigned, signal, 8);
+	assigned = std::move(moved);
+	assigned.reset();
+	REQUIRE(Max(Abs(ProcessInBlocks(assigned, signal, 16) - expected)) == 0.0f);
+}
+
+
+TEST_CASE("Non-uniform partitioned - Filter", "[PartitionedConvolution]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(500);
+	const auto filter = RandomSignal<float, TIME_DOMAIN>(200);
+	const auto conv = Convolution(signal, filter, CONV_FULL);
+	const auto expected = AsConstView(conv).subsignal(0, signal.size());
+
+	NonUniformConvolver<float> convolver{ filter, 32 };
+	const auto out = Filter(signal, convolver);
+	REQUIRE(Max(Abs(out - expected)) == Approx(0).margin(0.001f));
+}
@@ -0,0 +1,158 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Filtering/Windowing.hpp>
+#include <dspbb/Math/FFT.hpp>
+#include <dspbb/Math/Functions.hpp>
+#include <dspbb/Math/STFT.hpp>
+#include <dspbb/Math/Statistics.hpp>
+#include <dspbb/Primitives/Signal.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+
+using namespace dspbb;
+
+
+template <class T>
+Spectrum<std::complex<remove_complex_t<T>>> ReferenceStft(const Signal<T>& signal, const Signal<remove_complex_t<T>>& window, size_t hopSize, size_t fftSize) {
+	const size_t binCount = is_complex_v<T> ? fftSize : fftSize / 2 + 1;
+	Spectrum<std::complex<remove_complex_t<T>>> spectrogram;
+	for (size_t first = 0; first + window.size() <= signal.size(); first += hopSize) {
+		Signal<T> frame(fftSize, T(0));
+		Multiply(AsView(frame).subsignal(0, window.size()), AsConstView(signal).subsignal(first, window.size()), window);
+		Spectrum<std::complex<remove_complex_t<T>>> spectrum(binCount);
+		Fft(spectrum, frame);
+		spectrogram.append(spectrum);
+	}
+	return spectrogram;
+}
+
+
+TEST_CASE("STFT - Matches per-frame FFT", "[STFT]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(1000);
+	Signal<float> window(64);
+	HammingWindow(window);
+	const size_t hopSize = 16;
+	const size_t fftSize = 100;
+
+	Stft<float> stft{ AsConstView(window), hopSize, fftSize, 4 };
+	REQUIRE(stft.binCount() == 51);
+	const size_t frameCount = stft.frameCount(signal.size());
+	REQUIRE(frameCount == (1000 - 64) / 16 + 1);
+
+	Spectrum<std::complex<float>> spectrogram(frameCount * stft.binCount());
+	REQUIRE(stft.feed(AsView(spectrogram), AsConstView(signal)) == frameCount);
+
+	const auto expected = ReferenceStft(signal, window, hopSize, fftSize);
+	REQUIRE(expected.size() == spectrogram.size());
+	REQUIRE(Max(Abs(expected - spectrogram)) < 1e-4f);
+}
+
+
+TEST_CASE("STFT - Streaming in blocks", "[STFT]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(1000);
+	Signal<float> window(64);
+	HammingWindow(window);
+	const std::array<size_t, 3> hopSizes = { 16, 64, 90 };
+	const std::array<size_t, 6> blockSizes = { 1, 7, 30, 64, 131, 1000 };
+
+	for (auto hopSize : hopSizes) {
+		const auto expected = ReferenceStft(signal, window, hopSize, window.size());
+		for (auto blockSize : blockSizes) {
+			Stft<float> stft{ AsConstView(window), hopSize };
+			Spectrum<std::complex<float>> spectrogram(expected.size());
+			size_t numFrames = 0;
+			for (size_t first = 0; first < signal.size(); first += blockSize) {
+				const auto block = AsConstView(signal).subsignal(first, std::min(blockSize, signal.size() - first));
+				const size_t blockFrames = stft.frameCount(block.size());
+				const auto out = AsView(spectrogram).subsignal(numFrames * stft.binCount(), blockFrames * stft.binCount());
+				REQUIRE(stft.feed(out, block) == blockFrames);
+				numFrames += blockFrames;
+			}
+			REQUIRE(numFrames * stft.binCount() == expected.size());
+			REQUIRE(Max(Abs(expected - spectrogram)) < 1e-4f);
+		}
+	}
+}
+
+
+TEST_CASE("STFT - Complex input", "[STFT]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(500);
+	Signal<float> window(32);
+	HammingWindow(window);
+	const size_t hopSize = 8;
+
+	Stft<std::complex<float>> stft{ AsConstView(window), hopSize };
+	REQUIRE(stft.binCount() == 32);
+	Spectrum<std::complex<float>> spectrogram(stft.frameCount(signal.size()) * stft.binCount());
+	stft.feed(AsView(spectrogram), AsConstView(signal));
+
+	const auto expected = ReferenceStft(signal, window, hopSize, window.size());
+	REQUIRE(Max(Abs(expected - spectrogram)) < 1e-4f);
+}
+
+
+TEST_CASE("STFT - Reset", "[STFT]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(100);
+	Signal<float> window(32, 1.0f);
+
+	Stft<float> stft{ AsConstView(window), 32 };
+	Spectrum<std::complex<float>> spectrogram(3 * stft.binCount());
+	REQUIRE(stft.feed(AsView(spectrogram), AsConstView(signal).subsignal(0, 50)) == 1);
+	stft.reset();
+	REQUIRE(stft.frameCount(40) == 1);
+	REQUIRE(stft.feed(AsView(spectrogram), AsConstView(signal).subsignal(0, 40)) == 1);
+	REQUIRE(Max(Abs(AsView(spectrogram).subsignal(0, stft.binCount()) - Fft(AsConstView(signal).subsignal(0, 32), FFT_HALF))) < 1e-4f);
+}
+
+
+TEST_CASE("ISTFT - Round trip", "[STFT]") {
+	const auto signal = RandomSignal<float, TIME_DOMAIN>(1000);
+	const std::array<size_t, 4> hopSizes = { 8, 16, 24, 64 };
+	const size_t blockSize = 37;
+
+	for (auto hopSize : hopSizes) {
+		Signal<float> window(64);
+		HammingWindow(window);
+		Stft<float> stft{ AsConstView(window), hopSize, 80 };
+		Istft<float> istft{ AsConstView(window), hopSize, 80 };
+
+		Spectrum<std::complex<float>> spectrogram(stft.frameCount(signal.size()) * stft.binCount());
+		Signal<float> repro(signal.size(), 0.0f);
+		size_t numSamples = 0;
+		for (size_t first = 0; first < signal.size(); first += blockSize) {
+			const auto block = AsConstView(signal).subsignal(first, std::min(blockSize, signal.size() - first));
+			const size_t numFrames = stft.feed(AsView(spectrogram), block);
+			numSamples += istft.feed(AsView(repro).subsignal(numSamples), AsConstView(spectrogram).subsignal(0, numFrames * stft.binCount()));
+		}
+		REQUIRE(numSamples == ((signal.size() - window.size()) / hopSize + 1) * hopSize);
+
+		// The first samples are not covered by enough frames to be reconstructed.
+		const size_t settled = window.size() - hopSize;
+		const auto expected = AsConstView(signal).subsignal(settled, numSamples - settled);
+		const auto actual = AsConstView(repro).subsignal(settled, numSamples - settled);
+		REQUIRE(Max(Abs(expected - actual)) < 1e-4f);
+	}
+}
+
+
+TEST_CASE("ISTFT - Separate synthesis window", "[STFT]") {
+	const auto signal = RandomSignal<std::complex<float>, TIME_DOMAIN>(500);
+	Signal<float> analysis(48, 1.0f);
+	Signal<float> synthesis(48);
+	HammingWindow(synthesis);
+	const size_t hopSize = 12;
+
+	Stft<std::complex<float>> stft{ AsConstView(analysis), hopSize };
+	Istft<std::complex<float>> istft{ AsConstView(analysis), AsConstView(synthesis), hopSize };
+
+	Spectrum<std::complex<float>> spectrogram(stft.frameCount(signal.size()) * stft.binCount());
+	stft.feed(AsView(spectrogram), AsConstView(signal));
+	Signal<std::complex<float>> repro(signal.size());
+	const size_t numSamples = istft.feed(AsView(repro), AsConstView(spectrogram));
+
+	const size_t settled = analysis.size() - hopSize;
+	const auto expected = AsConstView(signal).subsignal(settled, numSamples - settled);
+	const auto actual = AsConstView(repro).subsignal(settled, numSamples - settled);
+	REQUIRE(Max(Abs(expected - actual)) < 1e-4f);
+}
@@ -0,0 +1,64 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Math/OverlapAdd.hpp>
+#include <dspbb/Math/Tuning.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+
+
+using namespace dspbb;
+using Catch::Approx;
+
+
+TEST_CASE("Tuning profile - Save & load", "[Tuning]") {
+	TuningProfile profile;
+	profile.fft = 4.125;
+	profile.add = 1.0;
+	profile.mul = 2.0 / 3.0;
+	profile.mac = 1.5;
+
+	std::stringstream ss;
+	SaveTuningProfile(ss, profile);
+	const auto loaded = LoadTuningProfile(ss);
+	REQUIRE(loaded.fft == profile.fft);
+	REQUIRE(loaded.add == profile.add);
+	REQUIRE(loaded.mul == profile.mul);
+	REQUIRE(loaded.mac == profile.mac);
+}
+
+TEST_CASE("Tuning profile - Load partial", "[Tuning]") {
+	std::stringstream ss{ "# calibrated\nmul 5\nunknown 3\n\n" };
+	const auto loaded = LoadTuningProfile(ss);
+	REQUIRE(loaded.fft == TuningProfile{}.fft);
+	REQUIRE(loaded.mul == 5.0);
+}
+
+TEST_CASE("Tuning profile - Load invalid", "[Tuning]") {
+	std::stringstream missing{ "fft\n" };
+	REQUIRE_THROWS_AS(LoadTuningProfile(missing), std::invalid_argument);
+	std::stringstream negative{ "add -1\n" };
+	REQUIRE_THROWS_AS(LoadTuningProfile(negative), std::invalid_argument);
+}
+
+TEST_CASE("Tuning profile - Consulted by OLA", "[Tuning]") {
+	const auto original = GetTuningProfile();
+	const ScopeExit restore{ [original] { SetTuningProfile(original); } };
+	REQUIRE(impl::ola::OptimalPracticalSize(55000, 30) == impl::ola::OptimalPracticalSize(55000, 30, original));
+
+	SetTuningProfile({ 6.0, 1.0, 2.0 });
+	REQUIRE(impl::ola::OptimalPracticalSize(55000, 30) == 256);
+	SetTuningProfile({ 1.0, 1.0, 50.0 });
+	REQUIRE(impl::ola::OptimalPracticalSize(55000, 30) > 256);
+	REQUIRE_THROWS_AS(SetTuningProfile({ 0.0, 1.0, 1.0 }), std::invalid_argument);
+	REQUIRE_THROWS_AS(SetTuningProfile({ 6.0, 1.0, 1.0, 0.0 }), std::invalid_argument);
+}
+
+TEST_CASE("Tuning profile - Calibrate", "[Tuning]") {
+	const auto profile = CalibrateTuningProfile<float>(256, 1);
+	REQUIRE(profile.add == 1.0);
+	REQUIRE(profile.fft > 0.0);
+	REQUIRE(profile.mul > 0.0);
+	REQUIRE(profile.mac > 0.0);
+}
@@ -1,12 +1,16 @@
 #pragma once
 
 #include <dspbb/Primitives/Signal.hpp>
+#include <dspbb/Primitives/SignalView.hpp>
 #include <dspbb/Utility/TypeTraits.hpp>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <complex>
+#include <functional>
 #include <random>
+#include <utility>
 
 
 #define TYPES_COMPLEX          \
@@ -134,4 +138,28 @@ dspbb::BasicSignal<T, Domain> RandomSignal(size_t length) {
 		}
 	}
 	return s;
-}
\ No newline at end of file
+}
+
+// Feeds signal to a streaming processor in blocks of blockSize samples; the last block may be shorter.
+// The processor must have a process(out, in) method that takes equally sized views.
+template <class Processor, class T>
+dspbb::Signal<T> ProcessInBlocks(Processor& processor, const dspbb::Signal<T>& signal, size_t blockSize) {
+	dspbb::Signal<T> out(signal.size());
+	for (size_t first = 0; first < signal.size(); first += blockSize) {
+		const size_t count = std::min(blockSize, signal.size() - first);
+		processor.process(dspbb::AsView(out).subsignal(first, count), dspbb::AsConstView(signal).subsignal(first, count));
+	}
+	return out;
+}
+
+// Calls func when leaving the scope, so global settings changed by a test are restored even if an assertion fails.
+class ScopeExit {
+public:
+	explicit ScopeExit(std::function<void()> func) : m_func(std::move(func)) {}
+	ScopeExit(const ScopeExit&) = delete;
+	ScopeExit& operator=(const ScopeExit&) = delete;
+	~ScopeExit() { m_func(); }
+
+private:
+	std::function<void()> m_func;
+};
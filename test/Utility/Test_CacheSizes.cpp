@@ -0,0 +1,25 @@
+#include "../TestUtils.hpp"
+
+#include <dspbb/Utility/CacheSizes.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace dspbb;
+
+
+TEST_CASE("Detect cache sizes", "[CacheSizes]") {
+	const auto sizes = DetectCacheSizes();
+	REQUIRE(sizes.l1 > 0);
+	REQUIRE(sizes.l2 > 0);
+}
+
+TEST_CASE("Set cache sizes", "[CacheSizes]") {
+	const auto original = GetCacheSizes();
+	const ScopeExit restore{ [original] { SetCacheSizes(original); } };
+
+	SetCacheSizes({ 4096, 65536 });
+	REQUIRE(GetCacheSizes().l1 == 4096);
+	REQUIRE(GetCacheSizes().l2 == 65536);
+	REQUIRE_THROWS_AS(SetCacheSizes({ 0, 65536 }), std::invalid_argument);
+	REQUIRE(GetCacheSizes().l1 == 4096);
+}
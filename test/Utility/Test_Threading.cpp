@@ -0,0 +1,65 @@
+#include <dspbb/Utility/Threading.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace dspbb;
+
+
+TEST_CASE("Parallel ranges cover all items", "[Threading]") {
+	constexpr size_t count = 103;
+	std::vector<int> visits(count, 0);
+	std::vector<int> workers(5, 0);
+	impl::ParallelRanges(count, workers.size(), [&](size_t first, size_t last, size_t worker) {
+		for (size_t i = first; i < last; ++i) {
+			++visits[i];
+		}
+		++workers[worker];
+	});
+	REQUIRE(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+	REQUIRE(std::all_of(workers.begin(), workers.end(), [](int v) { return v == 1; }));
+}
+
+TEST_CASE("Parallel ranges reuse threads", "[Threading]") {
+	std::mutex mutex;
+	std::set<std::thread::id> ids;
+	for (size_t repeat = 0; repeat < 20; ++repeat) {
+		impl::ParallelRanges(4, 4, [&](size_t, size_t, size_t) {
+			std::lock_guard lock(mutex);
+			ids.insert(std::this_thread::get_id());
+		});
+	}
+	// The calling thread and the pool's threads, which are started once and not per call.
+	REQUIRE(ids.size() <= impl::BatchWorkerCount(1000, 0) + 4);
+	REQUIRE(ids.size() < 20);
+}
+
+TEST_CASE("Parallel ranges nested", "[Threading]") {
+	std::atomic_size_t total = 0;
+	impl::ParallelRanges(4, 4, [&](size_t, size_t, size_t) {
+		impl::ParallelRanges(8, 4, [&](size_t first, size_t last, size_t) {
+			total += last - first;
+		});
+	});
+	REQUIRE(total == 32);
+}
+
+TEST_CASE("Parallel ranges rethrow", "[Threading]") {
+	std::atomic_size_t finished = 0;
+	const auto call = [&] {
+		impl::ParallelRanges(6, 3, [&](size_t first, size_t, size_t) {
+			if (first == 2) {
+				throw std::runtime_error("worker failed");
+			}
+			++finished;
+		});
+	};
+	REQUIRE_THROWS_AS(call(), std::runtime_error);
+	REQUIRE(finished == 2);
+}